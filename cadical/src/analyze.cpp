@@ -235,8 +235,11 @@ inline void Internal::bump_clause (Clause *c) {
   int new_glue = recompute_glue (c);
   if (new_glue < c->glue)
     promote_clause (c, new_glue);
-  else if (used && c->glue <= opts.reducetier2glue)
+  else if (used && c->glue <= opts.reducetier2glue) {
     c->used = 2;
+    if (c->tier == 3)
+      c->tier = 2; // Promote back if demoted.
+  }
 }
 
 /*------------------------------------------------------------------------*/
@@ -814,6 +817,7 @@ inline void Internal::otfs_subsume_clause (Clause *subsuming,
   }
   LOG ("turning redundant subsuming clause into irredundant clause");
   subsuming->redundant = false;
+  mark_dirty (subsuming);
   if (proof)
     proof->strengthen (subsuming->id);
   mark_garbage (subsumed);
@@ -1,30 +1,234 @@
 #include "internal.hpp"
 
+#ifdef CLAUSEREFS
+#include <map>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#endif
+
 namespace CaDiCaL {
 
+/*------------------------------------------------------------------------*/
+#ifdef CLAUSEREFS
+/*------------------------------------------------------------------------*/
+
+// The reserved range covers all 2^32 word offsets and is split into chunks
+// of 2^20 bytes aligned to the chunk size.  The first chunk is never used
+// such that the zero offset does not reference a clause.  Free chunks are
+// kept as map from the first chunk of a free sequence to its length.  This
+// global state is shared by all solvers and thus protected by a mutex.  It
+// is never deallocated, since solvers might be static objects destroyed
+// after other static objects.
+
+// If the address space is limited (as for instance by 'ulimit -v' or in
+// 'mobical') we only reserve a fraction of the available address space.
+
+static const unsigned clause_chunk_log = 20;
+static const size_t clause_chunk_bytes = (size_t) 1 << clause_chunk_log;
+static const size_t clause_region_chunks = (size_t) 1
+                                           << (32 + 3 - clause_chunk_log);
+
+char *clause_region;
+static size_t clause_region_size; // In number of chunks.
+
+static std::mutex clause_region_mutex;
+static std::map<size_t, size_t> *free_clause_chunks;
+
+static size_t bytes2chunks (size_t bytes) {
+  return (bytes + clause_chunk_bytes - 1) >> clause_chunk_log;
+}
+
+static char *allocate_clause_chunks (size_t chunks) {
+  std::lock_guard<std::mutex> lock (clause_region_mutex);
+  if (!clause_region) {
+    size_t size = clause_region_chunks;
+    struct rlimit rlim;
+    if (!getrlimit (RLIMIT_AS, &rlim) && rlim.rlim_cur != RLIM_INFINITY)
+      while (size > 16 && (size << clause_chunk_log) > rlim.rlim_cur / 4)
+        size /= 2;
+    void *p;
+    for (;;) {
+      const size_t bytes = (size + 1) << clause_chunk_log;
+      p = mmap (0, bytes, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+      if (p != MAP_FAILED)
+        break;
+      if (size <= 16)
+        fatal ("could not reserve %zu bytes for clauses", bytes);
+      size /= 2;
+    }
+    const size_t mask = clause_chunk_bytes - 1;
+    clause_region = (char *) (((size_t) p + mask) & ~mask);
+    clause_region_size = size;
+    free_clause_chunks = new std::map<size_t, size_t> ();
+    (*free_clause_chunks)[1] = size - 1;
+  }
+  for (auto it = free_clause_chunks->begin ();
+       it != free_clause_chunks->end (); it++) {
+    const size_t first = it->first, available = it->second;
+    if (available < chunks)
+      continue;
+    free_clause_chunks->erase (it);
+    if (available > chunks)
+      (*free_clause_chunks)[first + chunks] = available - chunks;
+    return clause_region + (first << clause_chunk_log);
+  }
+  fatal ("out of %zu bytes reserved memory for clauses",
+         clause_region_size << clause_chunk_log);
+  return 0;
+}
+
+// Released chunks are merged with adjacent free chunks and their physical
+// memory is given back to the operating system.
+
+static void release_clause_chunks (char *start, size_t chunks) {
+  madvise (start, chunks << clause_chunk_log, MADV_DONTNEED);
+  std::lock_guard<std::mutex> lock (clause_region_mutex);
+  size_t first = (start - clause_region) >> clause_chunk_log;
+  auto next = free_clause_chunks->lower_bound (first);
+  if (next != free_clause_chunks->end () && next->first == first + chunks) {
+    chunks += next->second;
+    next = free_clause_chunks->erase (next);
+  }
+  if (next != free_clause_chunks->begin ()) {
+    auto prev = next;
+    prev--;
+    if (prev->first + prev->second == first) {
+      first = prev->first;
+      chunks += prev->second;
+      free_clause_chunks->erase (prev);
+    }
+  }
+  (*free_clause_chunks)[first] = chunks;
+}
+
+// Each nursery chunk (or sequence of chunks for a large clause) starts with
+// this header, followed by the clauses allocated in it.
+
+struct ClauseChunk {
+  size_t live;   // Number of allocated and not yet deallocated clauses.
+  size_t chunks; // Number of consecutive chunks.
+};
+
+static ClauseChunk *clause_chunk (char *p) {
+  const size_t offset = p - clause_region;
+  const size_t mask = clause_chunk_bytes - 1;
+  return (ClauseChunk *) (clause_region + (offset & ~mask));
+}
+
+char *Arena::allocate (size_t bytes) {
+  const size_t header = sizeof (ClauseChunk);
+  if (header + bytes > clause_chunk_bytes) {
+    const size_t chunks = bytes2chunks (header + bytes);
+    ClauseChunk *chunk = (ClauseChunk *) allocate_clause_chunks (chunks);
+    chunk->live = 1;
+    chunk->chunks = chunks;
+    LOG ("allocated %zu chunks for clause with %zu bytes", chunks, bytes);
+    return (char *) (chunk + 1);
+  }
+  if (nursery.top + bytes > nursery.end) {
+    if (nursery.top) {
+      ClauseChunk *chunk = clause_chunk (nursery.top - 1);
+      if (!chunk->live)
+        release_clause_chunks ((char *) chunk, chunk->chunks);
+    }
+    ClauseChunk *chunk = (ClauseChunk *) allocate_clause_chunks (1);
+    chunk->live = 0;
+    chunk->chunks = 1;
+    nursery.top = (char *) (chunk + 1);
+    nursery.end = (char *) chunk + clause_chunk_bytes;
+    LOG ("new nursery chunk for clauses");
+  }
+  clause_chunk (nursery.top)->live++;
+  char *res = nursery.top;
+  nursery.top += bytes;
+  return res;
+}
+
+void Arena::deallocate (char *p) {
+  assert (!contains (p));
+  ClauseChunk *chunk = clause_chunk (p);
+  assert (chunk->live);
+  if (--chunk->live)
+    return;
+  if (nursery.top && chunk == clause_chunk (nursery.top - 1))
+    return;
+  release_clause_chunks ((char *) chunk, chunk->chunks);
+}
+
 Arena::Arena (Internal *i) {
   memset (this, 0, sizeof *this);
   internal = i;
 }
 
 Arena::~Arena () {
-  delete[] from.start;
-  delete[] to.start;
+  if (from.start)
+    release_clause_chunks (from.start, bytes2chunks (from.end - from.start));
+  if (to.start)
+    release_clause_chunks (to.start, bytes2chunks (to.end - to.start));
+  if (nursery.top) {
+    ClauseChunk *chunk = clause_chunk (nursery.top - 1);
+    assert (!chunk->live);
+    release_clause_chunks ((char *) chunk, chunk->chunks);
+  }
 }
 
 void Arena::prepare (size_t bytes) {
   LOG ("preparing 'to' space of arena with %zd bytes", bytes);
   assert (!to.start);
-  to.top = to.start = new char[bytes];
+  to.top = to.start = allocate_clause_chunks (bytes2chunks (bytes | 1));
   to.end = to.start + bytes;
+#ifdef MADV_HUGEPAGE
+  if (internal->opts.hugepages)
+    madvise (to.start, bytes, MADV_HUGEPAGE);
+#endif
 }
 
 void Arena::swap () {
-  delete[] from.start;
+  if (from.start)
+    release_clause_chunks (from.start, bytes2chunks (from.end - from.start));
   LOG ("delete 'from' space of arena with %zd bytes",
        (size_t) (from.end - from.start));
   from = to;
   to.start = to.top = to.end = 0;
 }
 
+/*------------------------------------------------------------------------*/
+#else
+/*------------------------------------------------------------------------*/
+
+Arena::Arena (Internal *i) {
+  memset (this, 0, sizeof *this);
+  internal = i;
+}
+
+Arena::~Arena () {
+  Pages *pages = &internal->pages;
+  if (from.start)
+    deallocate_pages (pages, from.start, from.end - from.start);
+  if (to.start)
+    deallocate_pages (pages, to.start, to.end - to.start);
+}
+
+void Arena::prepare (size_t bytes) {
+  LOG ("preparing 'to' space of arena with %zd bytes", bytes);
+  assert (!to.start);
+  to.top = to.start = (char *) allocate_pages (&internal->pages, bytes);
+  to.end = to.start + bytes;
+}
+
+void Arena::swap () {
+  if (from.start)
+    deallocate_pages (&internal->pages, from.start, from.end - from.start);
+  LOG ("delete 'from' space of arena with %zd bytes",
+       (size_t) (from.end - from.start));
+  from = to;
+  to.start = to.top = to.end = 0;
+}
+
+/*------------------------------------------------------------------------*/
+#endif
+/*------------------------------------------------------------------------*/
+
 } // namespace CaDiCaL
@@ -51,7 +51,47 @@ namespace CaDiCaL {
 //
 // One has to be really careful with 'qi' references to arena memory.
 
+// If compiled with '-DCLAUSEREFS' (configure option '--clause-refs') all
+// clauses are allocated in one large range of virtual memory, which is
+// reserved once for all solvers in the process but only backed by physical
+// memory where it is actually used.  Since clauses are 8 byte aligned a
+// clause can then be referenced by a 32-bit word offset into this range
+// ('ClauseRef'), which allows to address 32 GB of clauses and reduces the
+// size of watches from 16 to 12 bytes.  The range is split into chunks,
+// which are handed out to the arenas of different solvers.  Both spaces of
+// the arena consist of consecutive chunks.  New clauses are allocated in a
+// 'nursery' chunk, which starts with a header counting the number of live
+// clauses in it.  The chunk is given back as soon all its clauses are
+// deleted (or moved to the arena by the garbage collector) and it is not
+// used for allocation anymore.  Clauses larger than a chunk are allocated
+// in their own sequence of consecutive chunks.
+
 struct Internal;
+struct Clause;
+
+#ifdef CLAUSEREFS
+
+extern char *clause_region; // Start of reserved address range.
+
+class ClauseRef {
+
+  uint32_t offset; // In 8 byte words, thus '0' is never a valid clause.
+
+public:
+  ClauseRef () {}
+  ClauseRef (Clause *c) {
+    const size_t bytes = (char *) c - clause_region;
+    assert (c), assert (!(bytes & 7)), assert (bytes >> 3 <= UINT32_MAX);
+    offset = bytes >> 3;
+  }
+
+  operator Clause * () const {
+    return (Clause *) (clause_region + ((size_t) offset << 3));
+  }
+  Clause *operator->() const { return *this; }
+};
+
+#endif
 
 class Arena {
 
@@ -61,6 +101,12 @@ class Arena {
     char *start, *top, *end;
   } from, to;
 
+#ifdef CLAUSEREFS
+  struct {
+    char *top, *end; // Current chunk for new clauses.
+  } nursery;
+#endif
+
 public:
   Arena (Internal *);
   ~Arena ();
@@ -97,6 +143,15 @@ public:
   // explicitly copied to 'to' with 'copy' becomes invalid.
   //
   void swap ();
+
+#ifdef CLAUSEREFS
+  // Allocate and deallocate memory for a new clause in the nursery.  The
+  // memory of clauses in the 'from' space of the arena is not deallocated
+  // individually ('contains' has to be checked first).
+  //
+  char *allocate (size_t bytes);
+  void deallocate (char *);
+#endif
 };
 
 } // namespace CaDiCaL
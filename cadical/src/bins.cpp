@@ -19,4 +19,99 @@ void Internal::reset_bins () {
   LOG ("reset binary implication graph");
 }
 
+/*------------------------------------------------------------------------*/
+
+// Shared binary implication graph in compressed sparse row format.  The
+// edges of each literal are in the order of the binary clauses in
+// 'clauses'.
+
+void Internal::init_binary_graph () {
+  BinaryGraph &graph = bingraph;
+  const size_t size = 2 * (1 + (size_t) max_var);
+  graph.start.assign (size + 1, 0);
+  for (const auto &c : clauses) {
+    if (c->garbage || c->size != 2)
+      continue;
+    const int a = c->literals[0], b = c->literals[1];
+    if (!active (a) || !active (b))
+      continue;
+    graph.start[vlit (-a)]++;
+    graph.start[vlit (-b)]++;
+  }
+  size_t edges = 0;
+  for (auto &start : graph.start) {
+    edges += start;
+    start = edges;
+  }
+  graph.children.resize (edges);
+  graph.reasons.resize (edges);
+  for (auto i = clauses.rbegin (); i != clauses.rend (); i++) {
+    Clause *c = *i;
+    if (c->garbage || c->size != 2)
+      continue;
+    const int a = c->literals[0], b = c->literals[1];
+    if (!active (a) || !active (b))
+      continue;
+    const size_t j = --graph.start[vlit (-a)];
+    graph.children[j] = b;
+    graph.reasons[j] = c;
+    const size_t k = --graph.start[vlit (-b)];
+    graph.children[k] = a;
+    graph.reasons[k] = c;
+  }
+  graph.dirty.assign (size, false);
+  graph.built = graph.version;
+  graph.fixed = stats.all.fixed;
+  graph.changed = 0;
+  stats.bingraphs++;
+  LOG ("built binary implication graph with %zd edges", edges);
+}
+
+// Returns the binary implication graph of the current binary clauses and
+// rebuilds it if it is not up-to-date.
+
+const BinaryGraph &Internal::binary_graph () {
+  if (binary_graph_usable () && !bingraph.changed &&
+      bingraph.fixed == stats.all.fixed) {
+    stats.bingraphreused++;
+    LOG ("reusing binary implication graph");
+  } else
+    init_binary_graph ();
+  return bingraph;
+}
+
+// Probing keeps using the graph after changing binary clauses and units.
+
+bool Internal::binary_graph_usable () const {
+  const BinaryGraph &graph = bingraph;
+  return !graph.empty () && graph.built == graph.version &&
+         graph.dirty.size () == 2 * (1 + (size_t) max_var);
+}
+
+void Internal::binary_graph_changed (Clause *c) {
+  assert (c->size == 2);
+  BinaryGraph &graph = bingraph;
+  if (graph.empty ())
+    return;
+  graph.changed++;
+  for (int i = 0; i < 2; i++) {
+    const unsigned l = vlit (-c->literals[i]);
+    if (l < graph.dirty.size ())
+      graph.dirty[l] = true;
+    else
+      graph.version++; // new variable
+  }
+}
+
+void Internal::reset_binary_graph () {
+  BinaryGraph &graph = bingraph;
+  if (graph.empty ())
+    return;
+  erase_vector (graph.start);
+  erase_vector (graph.children);
+  erase_vector (graph.reasons);
+  erase_vector (graph.dirty);
+  LOG ("reset binary implication graph");
+}
+
 } // namespace CaDiCaL
@@ -17,6 +17,40 @@ typedef vector<Bin> Bins;
 inline void shrink_bins (Bins &bs) { shrink_vector (bs); }
 inline void erase_bins (Bins &bs) { erase_vector (bs); }
 
+struct Clause;
+
+// Binary implication graph in compressed sparse row format shared by
+// 'decompose', 'transred' and probing (see 'binary_graph' in 'bins.cpp').
+// The edges of literal 'lit', i.e., the literals implied by 'lit', are
+// stored in 'children' from 'start[vlit (lit)]' to 'start[vlit (lit) + 1]'
+// together with their binary clause in 'reasons'.  The graph only contains
+// binary clauses with active literals and is rebuilt lazily if binary
+// clauses were added or removed or new units were found since it was
+// built.  Those changes mark the literals with changed edges as 'dirty',
+// which allows probing to keep using the graph for all other literals
+// while adding hyper binary resolvents.  Only moving clauses during garbage
+// collection or new variables really invalidate it ('version' incremented).
+
+struct BinaryGraph {
+  vector<size_t> start;     // per literal start in 'children'
+  vector<int> children;     // implied literals
+  vector<Clause *> reasons; // binary clause of each edge
+  vector<bool> dirty;       // literals with edges changed since built
+  uint64_t version;         // incremented if clauses are moved
+  uint64_t built;           // 'version' when built
+  int64_t fixed;            // number of units when built
+  size_t changed;           // binary clauses added or removed since built
+
+  BinaryGraph () : version (0), built (0), fixed (0), changed (0) {}
+
+  bool empty () const { return start.empty (); }
+  size_t bytes () const {
+    return start.capacity () * sizeof (size_t) +
+           children.capacity () * sizeof (int) +
+           reasons.capacity () * sizeof (Clause *) + dirty.capacity () / 8;
+  }
+};
+
 } // namespace CaDiCaL
 
 #endif
@@ -162,21 +162,10 @@ void Internal::block_schedule (Blocker &blocker) {
       mark_skip (-lit);
   }
 
-  // Connect all literal occurrences in irredundant clauses.
+  // Connect all literal occurrences in irredundant clauses (or update the
+  // occurrence lists kept from the last elimination round).
   //
-  for (const auto &c : clauses) {
-
-    if (c->garbage)
-      continue;
-    if (c->redundant)
-      continue;
-
-    for (const auto &lit : *c) {
-      assert (active (lit));
-      assert (!val (lit));
-      occs (lit).push_back (c);
-    }
-  }
+  connect_occs ();
 
   // We establish the invariant that 'noccs' gives the number of actual
   // occurrences of 'lit' in non-garbage clauses,  while 'occs' might still
@@ -772,7 +761,6 @@ bool Internal::block () {
 
   mark_satisfied_clauses_as_garbage ();
 
-  init_occs ();  // Occurrence lists for all literals.
   init_noccs (); // Number of occurrences to avoid flushing garbage clauses.
 
   Blocker blocker (this);
@@ -783,7 +771,8 @@ bool Internal::block () {
   int64_t purelits = stats.blockpurelits;
   int64_t pured = stats.blockpured;
 
-  while (!terminated_asynchronously () && !blocker.schedule.empty ()) {
+  while (!terminated_asynchronously () && !inprocessing_suspended () &&
+         !blocker.schedule.empty ()) {
     int lit = u2i (blocker.schedule.front ());
     blocker.schedule.pop_front ();
     block_literal (blocker, lit);
@@ -792,7 +781,7 @@ bool Internal::block () {
 
   blocker.erase ();
   reset_noccs ();
-  reset_occs ();
+  keep_occs ();
 
   resolutions = stats.blockres - resolutions;
   blocked = stats.blocked - blocked;
@@ -520,6 +520,40 @@ public:
   //
   void copy (Solver &other) const;
 
+  // Same as 'copy' but the clauses are not replayed through the API of
+  // 'other'.  Instead they are directly allocated and watched in 'other',
+  // which also gets the redundant clauses, the saved phases and the
+  // variable scores of 'this', such that solving continues where 'this'
+  // stopped.  Falls back to copying clauses through the API if 'other'
+  // traces proofs or checks models, which both need the original clauses.
+  //
+  //   require (READY)          // for 'this'
+  //   ensure (READY)           // for 'this'
+  //
+  //   other.require (CONFIGURING)
+  //   other.ensure (STEADY)
+  //
+  void clone (Solver &other) const;
+
+  /*----------------------------------------------------------------------*/
+  // Save the same information as 'copy' to a compact binary file and in
+  // addition saved phases and scores of variables.  Loading such a snapshot
+  // into a fresh solver avoids parsing and simplifying the original formula
+  // again and the loaded solver has the same models as the saved one.  The
+  // variable maps are not saved but rebuilt while loading.  If loading
+  // fails the solver is only partially initialized and should be deleted.
+  //
+  // Returns zero if successful and otherwise an error message.
+  //
+  //   require (READY)          // for 'save_snapshot'
+  //   ensure (READY)
+  //
+  //   require (CONFIGURING)    // for 'load_snapshot'
+  //   ensure (CONFIGURING | STEADY)
+  //
+  const char *save_snapshot (const char *path);
+  const char *load_snapshot (const char *path);
+
   /*----------------------------------------------------------------------*/
   // Variables are usually added and initialized implicitly whenever a
   // literal is used as an argument except for the functions 'val', 'fixed',
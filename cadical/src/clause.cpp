@@ -93,12 +93,21 @@ Clause *Internal::new_clause (bool red, int glue) {
     keep = false;
 
   size_t bytes = Clause::bytes (size);
-  Clause *c = (Clause *) new char[bytes];
+#ifdef CLAUSEREFS
+  Clause *c = (Clause *) arena.allocate (bytes);
+  const bool on_slab = false;
+#else
+  Clause *c = opts.slab ? (Clause *) slab.allocate (bytes) : 0;
+  const bool on_slab = c;
+  if (!on_slab)
+    c = (Clause *) new char[bytes];
+#endif
 
   c->id = ++clause_id;
 
   c->conditioned = false;
   c->covered = false;
+  c->dirty = false;
   c->enqueued = false;
   c->frozen = false;
   c->garbage = false;
@@ -108,9 +117,11 @@ Clause *Internal::new_clause (bool red, int glue) {
   c->keep = keep;
   c->moved = false;
   c->reason = false;
+  c->slab = on_slab;
   c->redundant = red;
   c->transred = false;
   c->subsume = false;
+  c->tier = 0;
   c->vivified = false;
   c->vivify = false;
   c->used = 0;
@@ -137,14 +148,20 @@ Clause *Internal::new_clause (bool red, int glue) {
     stats.irrlits += size;
     stats.current.irredundant++;
     stats.added.irredundant++;
+    mark_dirty (c);
   }
 
   clauses.push_back (c);
+  if (red)
+    tier_clause (c);
   LOG (c, "new pointer %p", (void *) c);
 
   if (likely_to_be_kept_clause (c))
     mark_added (c);
 
+  if (size == 2)
+    binary_graph_changed (c);
+
   return c;
 }
 
@@ -163,11 +180,13 @@ void Internal::promote_clause (Clause *c, int new_glue) {
     LOG (c, "promoting with new glue %d to tier1", new_glue);
     stats.promoted1++;
     c->keep = true;
+    c->tier = 1;
   } else if (old_glue > opts.reducetier2glue &&
              new_glue <= opts.reducetier2glue) {
     LOG (c, "promoting with new glue %d to tier2", new_glue);
     stats.promoted2++;
     c->used = 2;
+    c->tier = 2;
   } else if (c->keep)
     LOG (c, "keeping with new glue %d in tier1", new_glue);
   else if (old_glue <= opts.reducetier2glue)
@@ -205,6 +224,8 @@ size_t Internal::shrink_clause (Clause *c, int new_size) {
   c->size = new_size;
   size_t new_bytes = c->bytes ();
   size_t res = old_bytes - new_bytes;
+  if (res && c->slab && !arena.contains (c))
+    slab.shrink ((char *) c, old_bytes, new_bytes);
 
   if (c->redundant)
     promote_clause (c, min (c->size - 1, c->glue));
@@ -217,6 +238,9 @@ size_t Internal::shrink_clause (Clause *c, int new_size) {
   if (likely_to_be_kept_clause (c))
     mark_added (c);
 
+  if (new_size == 2)
+    binary_graph_changed (c);
+
   return res;
 }
 
@@ -229,7 +253,14 @@ void Internal::deallocate_clause (Clause *c) {
   if (arena.contains (p))
     return;
   LOG (c, "deallocate pointer %p", (void *) c);
-  delete[] p;
+#ifdef CLAUSEREFS
+  arena.deallocate (p);
+#else
+  if (c->slab)
+    slab.deallocate (p, c->bytes ());
+  else
+    delete[] p;
+#endif
 }
 
 void Internal::delete_clause (Clause *c) {
@@ -312,6 +343,9 @@ void Internal::mark_garbage (Clause *c) {
   c->garbage = true;
   c->used = 0;
 
+  if (c->size == 2)
+    binary_graph_changed (c);
+
   LOG (c, "marked garbage pointer %p", (void *) c);
 }
 
@@ -537,6 +571,8 @@ Clause *Internal::new_learned_redundant_clause (int glue) {
 Clause *Internal::new_hyper_binary_resolved_clause (bool red, int glue) {
   external->check_learned_clause ();
   Clause *res = new_clause (red, glue);
+  if (red)
+    mark_hyper (res);
   if (proof) {
     proof->add_derived_clause (res, lrat_chain);
   }
@@ -551,6 +587,8 @@ Clause *Internal::new_hyper_ternary_resolved_clause (bool red) {
   external->check_learned_clause ();
   size_t size = clause.size ();
   Clause *res = new_clause (red, size);
+  if (red)
+    mark_hyper (res);
   if (proof) {
     proof->add_derived_clause (res, lrat_chain);
   }
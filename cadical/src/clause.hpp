@@ -34,6 +34,7 @@ struct Clause {
   };
   bool conditioned : 1; // Tried for globally blocked clause elimination.
   bool covered : 1;  // Already considered for covered clause elimination.
+  bool dirty : 1;    // Irredundant but not in kept occurrence lists.
   bool enqueued : 1; // Enqueued on backward queue.
   bool frozen : 1;   // Temporarily frozen (in covered clause elimination).
   bool garbage : 1;  // can be garbage collected unless it is a 'reason'
@@ -43,9 +44,11 @@ struct Clause {
   bool keep : 1;         // always keep this clause (if redundant)
   bool moved : 1;        // moved during garbage collector ('copy' valid)
   bool reason : 1;       // reason / antecedent clause can not be collected
+  bool slab : 1;         // allocated on the slab (see 'slab.hpp')
   bool redundant : 1;    // aka 'learned' so not 'irredundant' (original)
   bool transred : 1;     // already checked for transitive reduction
   bool subsume : 1;      // not checked in last subsumption round
+  unsigned tier : 2; // tier of redundant clause (see 'tier.hpp')
   unsigned used : 2; // resolved in conflict analysis since last 'reduce'
   bool vivified : 1; // clause already vivified
   bool vivify : 1;   // clause scheduled to be vivified
@@ -80,9 +83,10 @@ struct Clause {
   // being collected while for clauses in tier three not being used since
   // the last 'reduce' call makes them deletion candidates.  Clauses derived
   // by hyper binary or ternary resolution (even though small and thus with
-  // low glue) are always removed if they remain unused during one interval.
-  // See 'mark_useless_redundant_clauses_as_garbage' in 'reduce.cpp' and
-  // 'bump_clause' in 'analyze.cpp'.
+  // low glue) are always removed if they remain unused during one interval
+  // and thus are put into tier three independent of their glue.  See
+  // 'mark_useless_redundant_clauses_as_garbage' in 'reduce.cpp', 'Tiers' in
+  // 'tier.hpp' and 'bump_clause' in 'analyze.cpp'.
   //
   int glue;
 
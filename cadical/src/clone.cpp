@@ -0,0 +1,96 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Cloning a solver (see 'Solver::clone') copies the same clauses as
+// 'Solver::copy' but does not replay them through the API of the other
+// solver.  Instead they are mapped through the external variables to
+// the internal variables of the other solver and directly allocated and
+// watched there.  This requires that the other solver is fresh, i.e., its
+// external variables have just been initialized, and that it does not
+// trace proofs nor checks models, which both need the original clauses.
+// Redundant clauses are cloned too with their glue.  Root-level satisfied
+// clauses are skipped and falsified literals removed.
+
+void Internal::clone_clauses (Internal &other) {
+  assert (!unsat);
+  assert (!other.unsat);
+  assert (!other.level);
+  assert (!other.proof);
+  assert (other.clause.empty ());
+  assert (other.original.empty ());
+  const vector<int> &e2i = other.external->e2i;
+  START (clone);
+  int64_t cloned = 0;
+  for (const auto &c : clauses) {
+    if (c->garbage)
+      continue;
+    bool satisfied = false;
+    for (const auto &lit : *c) {
+      const int tmp = fixed (lit);
+      if (tmp > 0) {
+        satisfied = true;
+        break;
+      }
+      if (tmp < 0)
+        continue;
+      const int elit = externalize (lit);
+      const int other_idx = e2i[abs (elit)];
+      assert (other_idx > 0);
+      other.clause.push_back (elit < 0 ? -other_idx : other_idx);
+    }
+    if (!satisfied) {
+      if (other.clause.size () > 1) {
+        Clause *d = other.new_clause (c->redundant, c->glue);
+        other.watch_clause (d);
+        cloned++;
+      } else if (!c->redundant) {
+        // Unit (or empty) under the root-level assignment but not yet
+        // propagated, which requires the usual original clause handling.
+        swap (other.original, other.clause);
+        other.add_original_lit (0);
+        cloned++;
+      }
+    }
+    other.clause.clear ();
+  }
+  LOG ("cloned %" PRId64 " clauses", cloned);
+  STOP (clone);
+}
+
+// Saved phases, the order of the queue and the scores of active variables
+// are copied too (flags are copied in 'copy_flags').
+
+void External::clone_variables (External &other) const {
+  Internal *dst = other.internal;
+  vector<uint64_t> position (dst->max_var + 1, 0);
+  vector<uint64_t> this_position (internal->max_var + 1, 0);
+  uint64_t pos = 0;
+  for (int idx = internal->queue.first; idx;
+       idx = internal->links[idx].next)
+    this_position[idx] = ++pos;
+  const int limit = min (max_var, other.max_var);
+  for (int eidx = 1; eidx <= limit; eidx++) {
+    const int this_ilit = e2i[eidx];
+    if (!this_ilit || !internal->active (this_ilit))
+      continue;
+    const int other_ilit = other.e2i[eidx];
+    if (!other_ilit || !dst->active (other_ilit))
+      continue;
+    const int this_idx = abs (this_ilit);
+    const int other_idx = abs (other_ilit);
+    int phase = internal->phases.saved[this_idx];
+    if ((this_ilit < 0) != (other_ilit < 0))
+      phase = -phase;
+    dst->phases.saved[other_idx] = phase;
+    dst->stab[other_idx] = internal->stab[this_idx];
+    position[other_idx] = this_position[this_idx];
+  }
+  dst->score_inc = internal->score_inc;
+  dst->reorder_queue (position);
+  dst->rebuild_scores ();
+}
+
+} // namespace CaDiCaL
@@ -164,8 +164,7 @@ void Internal::unprotect_reasons () {
 // result is the number of remaining clauses, which in this context means
 // the number of non-garbage clauses.
 
-size_t Internal::flush_occs (int lit) {
-  Occs &os = occs (lit);
+size_t Internal::flush_occs (Occs &os) {
   const const_occs_iterator end = os.end ();
   occs_iterator j = os.begin ();
   const_occs_iterator i;
@@ -203,19 +202,23 @@ inline void Internal::flush_watches (int lit, Watches &saved) {
       continue;
     if (c->moved)
       c = w.clause = c->copy;
-    w.size = c->size;
     const int new_blit_pos = (c->literals[0] == lit);
     LOG (c, "clause in flush_watch starting from %d", lit);
     assert (c->literals[!new_blit_pos] == lit); /*FW1*/
-    w.blit = c->literals[new_blit_pos];
+    w = new_watch (lit, c->literals[new_blit_pos], c);
     if (w.binary ())
       *j++ = w;
     else
       saved.push_back (w);
   }
   ws.resize (j - ws.begin ());
+  // Large irredundant and tier one clauses are watched before the others.
   for (const auto &w : saved)
-    ws.push_back (w);
+    if (!w.clause->redundant || w.clause->tier == 1)
+      ws.push_back (w);
+  for (const auto &w : saved)
+    if (w.clause->redundant && w.clause->tier != 1)
+      ws.push_back (w);
   saved.clear ();
   shrink_vector (ws);
 }
@@ -225,6 +228,9 @@ void Internal::flush_all_occs_and_watches () {
     for (auto idx : vars)
       flush_occs (idx), flush_occs (-idx);
 
+  for (auto &os : ktab)
+    flush_occs (os);
+
   if (watching ()) {
     Watches tmp;
     for (auto idx : vars)
@@ -270,6 +276,7 @@ void Internal::update_reason_references () {
 void Internal::delete_garbage_clauses () {
 
   flush_all_occs_and_watches ();
+  flush_tiers ();
 
   LOG ("deleting garbage clauses");
 #ifndef QUIET
@@ -308,6 +315,7 @@ void Internal::copy_clause (Clause *c) {
   assert (!c->moved);
   char *p = (char *) c;
   char *q = arena.copy (p, c->bytes ());
+  ((Clause *) q)->slab = false;
   c->copy = (Clause *) q;
   c->moved = true;
   LOG ("copied clause[%" PRId64 "] from %p to %p", c->id, (void *) c,
@@ -318,6 +326,8 @@ void Internal::copy_clause (Clause *c) {
 
 void Internal::copy_non_garbage_clauses () {
 
+  bingraph.version++; // binary clauses are moved too
+
   size_t collected_clauses = 0, collected_bytes = 0;
   size_t moved_clauses = 0, moved_bytes = 0;
 
@@ -403,6 +413,7 @@ void Internal::copy_non_garbage_clauses () {
 
   flush_all_occs_and_watches ();
   update_reason_references ();
+  flush_tiers ();
 
   // Replace and flush clause references in 'clauses'.
   //
@@ -426,6 +437,11 @@ void Internal::copy_non_garbage_clauses () {
   //
   arena.swap ();
 
+  // All clauses outside of the arena are moved or deleted now.
+  //
+  if (slab.empty ())
+    slab.recycle ();
+
   PHASE ("collect", stats.collections,
          "collected %zd bytes %.0f%% of %zd garbage clauses",
          collected_bytes,
@@ -493,11 +509,10 @@ void Internal::remove_garbage_binaries () {
         if (c->collect ())
           continue;
         assert (!c->moved);
-        w.size = c->size;
         const int new_blit_pos = (c->literals[0] == lit);
         LOG (c, "clause in flush_watch starting from %d", lit);
         assert (c->literals[!new_blit_pos] == lit); /*FW1*/
-        w.blit = c->literals[new_blit_pos];
+        w = new_watch (lit, c->literals[new_blit_pos], c);
         if (w.binary ())
           *j++ = w;
         else
@@ -103,7 +103,7 @@ struct Mapper {
   /*----------------------------------------------------------------------*/
   // Map positive variable indices in vector.
   //
-  template <class T> void map_vector (vector<T> &v) {
+  template <class T, class A> void map_vector (vector<T, A> &v) {
     for (auto src : internal->vars) {
       const int dst = map_idx (src);
       if (!dst)
@@ -119,7 +119,7 @@ struct Mapper {
   /*----------------------------------------------------------------------*/
   // Map positive and negative variable indices in two-sided vector.
   //
-  template <class T> void map2_vector (vector<T> &v) {
+  template <class T, class A> void map2_vector (vector<T, A> &v) {
     for (auto src : internal->vars) {
       const int dst = map_idx (src);
       if (!dst)
@@ -178,6 +178,7 @@ void Internal::compact () {
   assert (propagated == trail.size ());
 
   garbage_collection ();
+  reset_binary_graph (); // variables are renumbered
 
   Mapper mapper (this);
 
@@ -278,12 +279,15 @@ void Internal::compact () {
     }
   }
 
-  // Map the blocking literals in all watches.
+  // Map the blocking (and inlined third) literals in all watches.
   //
   if (!wtab.empty ())
     for (auto lit : lits)
-      for (auto &w : watches (lit))
+      for (auto &w : watches (lit)) {
         w.blit = mapper.map_lit (w.blit);
+        if (w.ternary ())
+          w.set_third (mapper.map_lit (w.third ()));
+      }
 
   // We first flush inactive variables and map the links in the queue.  This
   // has to be done before we map the actual links data structure 'links'.
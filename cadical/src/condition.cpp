@@ -38,6 +38,8 @@ bool Internal::conditioning () {
     return false;
   if (!preprocessing && !opts.inprocessing)
     return false;
+  if (!preprocessing && inprocessing_suspended ())
+    return false;
   if (preprocessing)
     assert (lim.preprocessing);
 
@@ -492,6 +494,8 @@ long Internal::condition_round (long delta) {
     bool terminated_or_limit_hit = true;
     if (terminated_asynchronously ())
       LOG ("asynchronous termination detected");
+    else if (inprocessing_suspended ())
+      LOG ("inprocessing suspended by latency budget");
     else if (stats.condprops >= limit)
       LOG ("condition propagation limit %ld hit", limit);
     else
@@ -129,7 +129,7 @@ bool Internal::cover_propagate_asymmetric (int lit, Clause *ignore,
       lits[0] = other, lits[1] = lit;
       const signed char u = val (other);
       if (u > 0)
-        j[-1].blit = other;
+        j[-1].update_blit (other);
       else {
         const int size = w.clause->size;
         const const_literal_iterator end = lits + size;
@@ -148,7 +148,7 @@ bool Internal::cover_propagate_asymmetric (int lit, Clause *ignore,
         w.clause->pos = k - lits;
         assert (lits + 2 <= k), assert (k <= w.clause->end ());
         if (v > 0)
-          j[-1].blit = r;
+          j[-1].update_blit (r);
         else if (!v) {
           LOG (w.clause, "unwatch %d in", lit);
           lits[1] = r;
@@ -612,8 +612,8 @@ int64_t Internal::cover_round () {
   //
   int64_t covered = 0;
   //
-  while (!terminated_asynchronously () && !schedule.empty () &&
-         stats.propagations.cover < limit) {
+  while (!terminated_asynchronously () && !inprocessing_suspended () &&
+         !schedule.empty () && stats.propagations.cover < limit) {
     Clause *c = schedule.back ();
     schedule.pop_back ();
     c->covered = true;
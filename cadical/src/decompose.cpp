@@ -188,6 +188,17 @@ bool Internal::decompose_round () {
   vector<int> work; // depth first search working stack
   vector<int> scc;  // collects members of one SCC
 
+  // Instead of the watch lists, where binary watches are mixed with those
+  // of large clauses, we traverse the shared binary implication graph.  It
+  // only contains active literals and is not modified during the search.
+  //
+  const BinaryGraph &graph = binary_graph ();
+  PHASE ("decompose", stats.decompositions,
+         "implication graph with %zd edges in %.0f MB",
+         graph.children.size (), graph.bytes () / (double) (1 << 20));
+  const auto &start = graph.start;
+  const auto &children = graph.children;
+
   // The binary implication graph might have disconnected components and
   // thus we have in general to start several depth first searches.
 
@@ -213,10 +224,10 @@ bool Internal::decompose_round () {
         } else {
           assert (!reprs[vlit (parent)]);
 
-          // Go over all implied literals, thus need to iterate over all
-          // binary watched clauses with the negation of 'parent'.
+          // Go over all implied literals, i.e., the edges of 'parent'.
 
-          Watches &ws = watches (-parent);
+          const size_t begin = start[vlit (parent)];
+          const size_t end = start[vlit (parent) + 1];
 
           // Two cases: Either the node has never been visited before, i.e.,
           // it's depth first search index is zero, then perform the
@@ -234,12 +245,8 @@ bool Internal::decompose_round () {
 
             unsigned new_min = parent_dfs.min;
 
-            for (const auto &w : ws) {
-              if (!w.binary ())
-                continue;
-              const int child = w.blit;
-              if (!active (child))
-                continue;
+            for (size_t i = begin; i != end; i++) {
+              const int child = children[i];
               DFS &child_dfs = dfs[vlit (child)];
               if (new_min > child_dfs.min)
                 new_min = child_dfs.min;
@@ -287,19 +294,15 @@ bool Internal::decompose_round () {
                 while (!todo.empty ()) {
                   const int next = todo.back ();
                   todo.pop_back ();
-                  Watches &next_ws = watches (-next);
-                  for (const auto &w : next_ws) {
-                    if (!w.binary ())
-                      continue;
-                    const int child = w.blit;
-                    if (!active (child))
-                      continue;
+                  const size_t next_end = start[vlit (next) + 1];
+                  for (size_t i = start[vlit (next)]; i != next_end; i++) {
+                    const int child = children[i];
                     if (!flags (child).seen)
                       continue;
                     DFS &child_dfs = dfs[vlit (child)];
                     if (child_dfs.parent)
                       continue;
-                    child_dfs.parent = w.clause;
+                    child_dfs.parent = graph.reasons[i];
                     todo.push_back (child);
                   }
                 }
@@ -400,12 +403,8 @@ bool Internal::decompose_round () {
             // Now traverse all the children in the binary implication
             // graph but keep 'parent' on the stack for 'post-fix' work.
 
-            for (const auto &w : ws) {
-              if (!w.binary ())
-                continue;
-              const int child = w.blit;
-              if (!active (child))
-                continue;
+            for (size_t i = begin; i != end; i++) {
+              const int child = children[i];
               DFS &child_dfs = dfs[vlit (child)];
               if (child_dfs.idx)
                 continue;
@@ -652,6 +651,14 @@ bool Internal::decompose_round () {
       if (c->size == 2) { // cheaper to update only new binary clauses
         update_watch_size (watches (c->literals[0]), c->literals[1], c);
         update_watch_size (watches (c->literals[1]), c->literals[0], c);
+      } else if (c->size == 3 && opts.inlineternary) {
+        // The inlined third literal has been substituted.
+        for (const auto lit : {c->literals[0], c->literals[1]}) {
+          const int blit = c->literals[0] ^ c->literals[1] ^ lit;
+          for (auto &w : watches (lit))
+            if (w.clause == c)
+              w = new_watch (lit, blit, c);
+        }
       }
       LOG (c, "substituted");
     }
@@ -64,6 +64,8 @@ bool Internal::eliminating () {
     return false;
   if (!preprocessing && !opts.inprocessing)
     return false;
+  if (!preprocessing && inprocessing_suspended ())
+    return false;
   if (preprocessing)
     assert (lim.preprocessing);
 
@@ -659,10 +661,13 @@ void Internal::mark_eliminated_clauses_as_garbage (Eliminator &eliminator,
 
 /*------------------------------------------------------------------------*/
 
-// Try to eliminate 'pivot' by bounded variable elimination.
+// Try to eliminate 'pivot' by bounded variable elimination.  If given, the
+// 'candidate' result computed in parallel replaces computing the number of
+// resolvents, unless gates were found or the clauses of 'pivot' changed.
 
 void Internal::try_to_eliminate_variable (Eliminator &eliminator,
-                                          int pivot) {
+                                          int pivot,
+                                          const ElimCandidate *candidate) {
 
   if (!active (pivot))
     return;
@@ -698,11 +703,20 @@ void Internal::try_to_eliminate_variable (Eliminator &eliminator,
   Occs &ns = occs (-pivot);
   stable_sort (ns.begin (), ns.end (), clause_smaller_size ());
 
+  const int64_t irredundant = stats.current.irredundant;
+  const size_t units = trail.size ();
+
   if (pos)
     find_gate_clauses (eliminator, pivot);
 
   if (!unsat && !val (pivot)) {
-    if (elim_resolvents_are_bounded (eliminator, pivot)) {
+    bool bounded;
+    if (!candidate || !candidate->result || candidate->pivot != pivot ||
+        irredundant != stats.current.irredundant ||
+        units != trail.size () ||
+        !elim_reuse_candidate (eliminator, *candidate, bounded))
+      bounded = elim_resolvents_are_bounded (eliminator, pivot);
+    if (bounded) {
       LOG ("number of resolvents on %d are bounded", pivot);
       elim_add_resolvents (eliminator, pivot);
       if (!unsat)
@@ -743,6 +757,285 @@ void Internal::
 
 /*------------------------------------------------------------------------*/
 
+// Parallel bounded variable elimination.  Most of the time during
+// elimination rounds is spent in computing the number of non-tautological
+// resolvents of candidates, which for most candidates exceeds the bound.
+// With 'opts.threads > 1' we greedily pick a set of candidates from the
+// front of the schedule, such that no two candidates share a variable in
+// their clauses (the first color class of a greedy coloring of the
+// occurrence graph restricted to scheduled candidates).  Conflicting
+// candidates are rescheduled for the next set.  The number of resolvents of
+// the candidates in the set is then computed in parallel without modifying
+// the solver state.  Finally candidates are tried sequentially in schedule
+// order, where the parallel result replaces the sequential computation.
+
+// Eliminating a candidate only adds and removes clauses with variables in
+// its own clauses, which thus does not change the clauses of other
+// candidates in the set.  The only exception are derived units, after
+// which we fall back to sequential computation for the rest of the set.
+// Resolutions with side effects (satisfied antecedents, units and
+// on-the-fly self-subsumption) are not simulated but also lead to
+// sequential computation for that candidate.  Thus the parallel result is
+// always the one the sequential computation would produce and the
+// elimination result only depends on the candidate sets and not on the
+// number of threads.  With 'opts.threads = 1' candidates are tried one by
+// one as before.
+
+/*------------------------------------------------------------------------*/
+
+// Mark all variables in clauses with 'pivot' or '-pivot' unless one of them
+// is already marked for a previous candidate in the current set.
+
+bool Internal::elim_mark_neighbours (Eliminator &eliminator, int pivot) {
+  for (int phase = 0; phase < 2; phase++)
+    for (const auto &c : occs (phase ? -pivot : pivot))
+      for (const auto &lit : *c)
+        if (active (lit) && marked (abs (lit))) {
+          LOG ("candidate %d depends on previous candidate through %d",
+               pivot, abs (lit));
+          return false;
+        }
+  vector<int> &neighbours = eliminator.neighbours;
+  for (int phase = 0; phase < 2; phase++)
+    for (const auto &c : occs (phase ? -pivot : pivot))
+      for (const auto &lit : *c) {
+        const int idx = abs (lit);
+        if (!active (idx) || marked (idx))
+          continue;
+        mark (idx);
+        neighbours.push_back (idx);
+      }
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Compute the number of non-tautological resolvents on the candidate pivot
+// in the same order as 'elim_resolvents_are_bounded' (without gates).  This
+// function is executed by worker threads and thus only reads the solver
+// state and uses its own 'marks'.  If a resolution would have side effects
+// the result stays 'UNKNOWN'.
+
+void Internal::elim_check_candidate (ElimCandidate &candidate,
+                                     vector<signed char> &marks) {
+  const int pivot = candidate.pivot;
+  const Occs &ps = occs (pivot);
+  const Occs &ns = occs (-pivot);
+  const int64_t pos = ps.size ();
+  const int64_t neg = ns.size ();
+  if (!pos || !neg)
+    return;
+  const int64_t bound = pos + neg + lim.elimbound;
+
+  int64_t resolvents = 0, tried = 0;
+
+  for (const auto &c : ps) {
+    if (c->garbage)
+      continue;
+    for (const auto &d : ns) {
+      if (d->garbage)
+        continue;
+      tried++;
+      Clause *a = c, *b = d;
+      int p = pivot;
+      if (a->size > b->size)
+        p = -p, swap (a, b);
+      int s = 0, t = 0, size = 0;
+      bool side_effect = false, tautological = false;
+      for (const auto &lit : *a) {
+        if (lit == p) {
+          s++;
+          continue;
+        }
+        const signed char tmp = val (lit);
+        if (tmp > 0) {
+          side_effect = true;
+          break;
+        } else if (!tmp)
+          marks[abs (lit)] = sign (lit), s++, size++;
+      }
+      if (!side_effect) {
+        for (const auto &lit : *b) {
+          if (lit == -p) {
+            t++;
+            continue;
+          }
+          const signed char tmp = val (lit);
+          if (tmp > 0) {
+            side_effect = true;
+            break;
+          } else if (tmp < 0)
+            continue;
+          const signed char mark = marks[abs (lit)];
+          if (mark == -sign (lit)) {
+            tautological = true;
+            break;
+          } else if (!mark)
+            size++;
+          t++;
+        }
+      }
+      for (const auto &lit : *a)
+        marks[abs (lit)] = 0;
+      if (side_effect)
+        return;
+      if (tautological)
+        continue;
+      if (size < 2 || s > size || t > size)
+        return;
+      resolvents++;
+      if (size > opts.elimclslim || resolvents > bound) {
+        candidate.result = ElimCandidate::UNBOUNDED;
+        candidate.tried = tried;
+        return;
+      }
+    }
+  }
+
+  candidate.result = ElimCandidate::BOUNDED;
+  candidate.tried = tried;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Use the result of checking a candidate in parallel instead of computing
+// the number of resolvents again.  Without gates it is the same result as
+// the one of 'elim_resolvents_are_bounded'.  With gates only gate clauses
+// are resolved with non-gate clauses.  Thus if all resolvents are bounded
+// then also the resolvents with gate clauses are bounded (and all pairs
+// are tried), while otherwise we have to compute them.
+
+bool Internal::elim_reuse_candidate (Eliminator &eliminator,
+                                     const ElimCandidate &candidate,
+                                     bool &bounded) {
+  const int pivot = candidate.pivot;
+  int64_t tried = candidate.tried;
+  if (!eliminator.gates.empty ()) {
+    if (candidate.result != ElimCandidate::BOUNDED)
+      return false;
+    int64_t pos = 0, pos_gates = 0;
+    for (const auto &c : occs (pivot))
+      if (!c->garbage)
+        pos++, pos_gates += c->gate;
+    int64_t neg = 0, neg_gates = 0;
+    for (const auto &d : occs (-pivot))
+      if (!d->garbage)
+        neg++, neg_gates += d->gate;
+    tried = pos_gates * (neg - neg_gates) + (pos - pos_gates) * neg_gates;
+  }
+  LOG ("reusing parallel check of resolvents on %d", pivot);
+  stats.elimtried++;
+  stats.elimres += tried;
+  stats.elimrestried += tried;
+  stats.elimreused++;
+  bounded = (candidate.result == ElimCandidate::BOUNDED);
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Pick the next independent set of candidates from the schedule, check
+// them in parallel and then try to eliminate them in order.  Returns the
+// number of tried candidates.
+
+int64_t Internal::elim_independent_set (Eliminator &eliminator,
+                                        int64_t resolution_limit) {
+
+  ElimSchedule &schedule = eliminator.schedule;
+  vector<ElimCandidate> &candidates = eliminator.candidates;
+  vector<int> &neighbours = eliminator.neighbours;
+  assert (candidates.empty ());
+  assert (neighbours.empty ());
+
+  int64_t tried = 0, scanned = 0;
+  vector<int> deferred;
+
+  while (!schedule.empty () && scanned++ < opts.elimsetlim) {
+    const int idx = schedule.front ();
+    schedule.pop_front ();
+    flags (idx).elim = false;
+    if (!active (idx)) {
+      tried++;
+      continue;
+    }
+    assert (!frozen (idx));
+
+    // Same normalization as in 'try_to_eliminate_variable', which then
+    // does not change the occurrence lists nor the phase of the pivot.
+    //
+    int pivot = idx;
+    int64_t pos = flush_occs (pivot);
+    int64_t neg = flush_occs (-pivot);
+    if (pos > neg) {
+      pivot = -pivot;
+      swap (pos, neg);
+    }
+    if (pos && neg > opts.elimocclim) {
+      LOG ("too many occurrences thus not eliminated %d", pivot);
+      tried++;
+      continue;
+    }
+    if (!elim_mark_neighbours (eliminator, pivot)) {
+      deferred.push_back (idx);
+      continue;
+    }
+    Occs &ps = occs (pivot);
+    stable_sort (ps.begin (), ps.end (), clause_smaller_size ());
+    Occs &ns = occs (-pivot);
+    stable_sort (ns.begin (), ns.end (), clause_smaller_size ());
+    candidates.push_back (ElimCandidate (pivot));
+  }
+
+  for (const auto &idx : neighbours)
+    unmark (idx);
+  neighbours.clear ();
+
+  for (const auto &idx : deferred)
+    schedule.push_back (idx);
+
+  LOG ("independent set of %zd candidates (%zd deferred)",
+       candidates.size (), deferred.size ());
+
+  stats.elimsets++;
+  stats.elimchecked += candidates.size ();
+
+  const unsigned threads = opts.threads;
+  if (eliminator.marks.size () < threads)
+    eliminator.marks.resize (threads);
+
+  parallel_jobs (threads, candidates.size (),
+                 [&] (unsigned worker, size_t i) {
+                   vector<signed char> &marks = eliminator.marks[worker];
+                   if (marks.size () <= (size_t) max_var)
+                     marks.resize (max_var + 1, 0);
+                   elim_check_candidate (candidates[i], marks);
+                 });
+
+  const size_t units = trail.size ();
+
+  size_t i = 0;
+  while (i < candidates.size ()) {
+    if (unsat || terminated_asynchronously () ||
+        inprocessing_suspended () || stats.elimres > resolution_limit)
+      break;
+    const ElimCandidate &candidate = candidates[i++];
+    const int idx = abs (candidate.pivot);
+    if (schedule.contains (idx))
+      continue; // Rescheduled by removing one of its clauses above.
+    const bool valid = (units == trail.size ());
+    try_to_eliminate_variable (eliminator, idx, valid ? &candidate : 0);
+    tried++;
+  }
+
+  while (i < candidates.size ())
+    schedule.push_back (abs (candidates[i++].pivot));
+  candidates.clear ();
+
+  return tried;
+}
+
+/*------------------------------------------------------------------------*/
+
 // This function performs one round of bounded variable elimination and
 // returns the number of eliminated variables. The additional result
 // 'completed' is true if this elimination round ran to completion (all
@@ -812,8 +1105,6 @@ int Internal::elim_round (bool &completed) {
     }
   }
 
-  init_occs ();
-
   Eliminator eliminator (this);
   ElimSchedule &schedule = eliminator.schedule;
 
@@ -843,13 +1134,9 @@ int Internal::elim_round (bool &completed) {
          "scheduled %" PRId64 " variables %.0f%% for elimination",
          scheduled, percent (scheduled, active ()));
 
-  // Connect irredundant clauses.
+  // Connect irredundant clauses (or update kept occurrence lists).
   //
-  for (const auto &c : clauses)
-    if (!c->garbage && !c->redundant)
-      for (const auto &lit : *c)
-        if (active (lit))
-          occs (lit).push_back (c);
+  connect_occs ();
 
 #ifndef QUIET
   const int64_t old_resolutions = stats.elimres;
@@ -870,14 +1157,24 @@ int Internal::elim_round (bool &completed) {
   int64_t tried = 0;
 #endif
   while (!unsat && !terminated_asynchronously () &&
-         stats.elimres <= resolution_limit && !schedule.empty ()) {
-    int idx = schedule.front ();
-    schedule.pop_front ();
-    flags (idx).elim = false;
-    try_to_eliminate_variable (eliminator, idx);
+         !inprocessing_suspended () && stats.elimres <= resolution_limit &&
+         !schedule.empty ()) {
+    if (opts.threads > 1) {
+      const int64_t set = elim_independent_set (eliminator, resolution_limit);
 #ifndef QUIET
-    tried++;
+      tried += set;
+#else
+      (void) set;
+#endif
+    } else {
+      int idx = schedule.front ();
+      schedule.pop_front ();
+      flags (idx).elim = false;
+      try_to_eliminate_variable (eliminator, idx);
+#ifndef QUIET
+      tried++;
 #endif
+    }
     if (stats.garbage.literals <= garbage_limit)
       continue;
     mark_redundant_clauses_with_eliminated_variables_as_garbage ();
@@ -894,6 +1191,13 @@ int Internal::elim_round (bool &completed) {
          "tried to eliminate %" PRId64 " variables %.0f%% (%zd remain)",
          tried, percent (tried, scheduled), schedule.size ());
 
+  // If suspended due to the latency budget (see 'latency.cpp') keep the
+  // remaining candidates scheduled for the next elimination phase.
+  //
+  if (lim.latency.suspended)
+    for (const auto &idx : schedule)
+      mark_elim (idx);
+
   schedule.erase ();
 
   // Collect potential literal clause instantiation pairs, which needs full
@@ -903,7 +1207,7 @@ int Internal::elim_round (bool &completed) {
   if (!unsat && !terminated_asynchronously () && opts.instantiate)
     collect_instantiation_candidates (instantiator);
 
-  reset_occs ();
+  keep_occs ();
   reset_noccs ();
 
   // Mark all redundant clauses with eliminated variables as garbage.
@@ -1013,6 +1317,11 @@ void Internal::elim (bool update_limits) {
 
   reset_watches (); // saves lots of memory
 
+  // Occurrence lists are kept between elimination and blocked clause
+  // elimination rounds of this phase (see 'occs.cpp').
+  //
+  keeping_occs = opts.elimoccs;
+
   // Alternate one round of bounded variable elimination ('elim_round') and
   // subsumption ('subsume_round'), blocked ('block') and covered clause
   // elimination ('cover') until nothing changes, or the round limit is hit.
@@ -1028,7 +1337,8 @@ void Internal::elim (bool update_limits) {
 
   int round = 1;
 
-  while (!unsat && !phase_complete && !terminated_asynchronously ()) {
+  while (!unsat && !phase_complete && !terminated_asynchronously () &&
+         !inprocessing_suspended ()) {
 
     bool round_complete;
 
@@ -1086,6 +1396,8 @@ void Internal::elim (bool update_limits) {
            stats.elimcompleted + 1, lim.elimbound);
   }
 
+  drop_kept_occs ();
+
   init_watches ();
   connect_watches ();
 
@@ -1119,6 +1431,8 @@ void Internal::elim (bool update_limits) {
 
   if (!update_limits)
     return;
+  if (lim.latency.suspended)
+    return; // Resume in next 'solve' call.
 
   int64_t delta = scale (opts.elimint * (stats.elimphases + 1));
   lim.elim = stats.conflicts + delta;
@@ -15,6 +15,22 @@ struct elim_more {
 
 typedef heap<elim_more> ElimSchedule;
 
+// With more than one thread candidates are tried in sets of variables with
+// disjoint clause neighbourhoods and the number of resolvents of each
+// candidate is computed in parallel before (see 'elim_independent_set').
+
+struct ElimCandidate {
+  enum Result {
+    UNKNOWN = 0, // not computed or with side effects, thus try sequentially
+    BOUNDED = 1,
+    UNBOUNDED = 2,
+  };
+  int pivot;      // after normalizing its phase as in elimination
+  int result;     // one of the above
+  int64_t tried;  // number of resolutions until the result is known
+  ElimCandidate (int p) : pivot (p), result (UNKNOWN), tried (0) {}
+};
+
 struct Eliminator {
 
   Internal *internal;
@@ -30,6 +46,10 @@ struct Eliminator {
 
   vector<Clause *> gates;
   vector<int> marked;
+
+  vector<ElimCandidate> candidates;  // current independent set
+  vector<int> neighbours;            // marked variables of that set
+  vector<vector<signed char>> marks; // scratch marks per worker thread
 };
 
 } // namespace CaDiCaL
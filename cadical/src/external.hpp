@@ -44,6 +44,7 @@ using namespace std;
 struct Clause;
 struct Internal;
 struct CubesWithStatus;
+class Image;
 
 /*------------------------------------------------------------------------*/
 
@@ -371,6 +372,15 @@ struct External {
 
   void copy_flags (External &other) const;
 
+  // Copy phases and scores too while cloning (see 'clone.cpp').
+
+  void clone_variables (External &other) const;
+
+  // Saved phases, scores and flags in solver images (see 'image.cpp').
+
+  bool write_image_variables (Image &) const;
+  bool read_image_variables (Image &, int vars);
+
   /*----------------------------------------------------------------------*/
 
   // Check solver behaves as expected during testing and debugging.
@@ -31,6 +31,10 @@ struct Flags { // Variable flags.
   unsigned char block : 2; // removed since last 'block' round (*)
   unsigned char skip : 2;  // skip this literal as blocking literal
 
+  // Literals with stale kept occurrence lists (see 'occs.cpp').
+  //
+  unsigned char stale : 2;
+
   // Bits for handling assumptions.
   //
   unsigned char assumed : 2;
@@ -53,7 +57,7 @@ struct Flags { // Variable flags.
     seen = keep = poison = removable = shrinkable = added = false;
     subsume = elim = ternary = true;
     block = 3u;
-    skip = assumed = failed = decompose = 0;
+    skip = stale = assumed = failed = decompose = 0;
     status = UNUSED;
   }
 
@@ -202,7 +202,7 @@ bool Internal::flippable (int lit) {
     const int other = lits[0] ^ lits[1] ^ lit;
     const signed char u = val (other);
     if (u > 0) {
-      i->blit = other;
+      i->update_blit (other);
       continue;
     }
 
@@ -231,7 +231,7 @@ bool Internal::flippable (int lit) {
     assert (lits + 2 <= k);
     assert (k <= w.clause->end ());
     w.clause->pos = k - lits;
-    i->blit = r;
+    i->update_blit (r);
   }
 
 #ifdef LOGGING
@@ -0,0 +1,198 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// A solver image consists of the following sections, all in terms of
+// external variables, which are written by 'Solver::save_snapshot':
+//
+//   header     'Image::magic' followed by the maximum external variable
+//   options    number of options, then pairs of option name and value
+//   clauses    number of clauses, then literals of each clause and zero
+//   witnesses  number of witnesses, then for each witness its literals
+//              and zero, its clause identifier, then the literals of its
+//              clause and zero (as in 'traverse_witnesses_forward')
+//   variables  the score increment and then for each external variable a
+//              byte with its flags which if non-zero is followed by its
+//              saved phase, its position in the queue and its score.
+//
+// Loading replays the clauses and witnesses as 'Solver::copy' does, which
+// in turn determines the mapping between external and internal variables.
+// Thus these maps are not stored but the variable data is mapped through
+// the maps of the loading solver.
+
+const char *Image::magic = "cadical-image 1\n";
+
+bool Image::put (uint64_t n) {
+  while (n > 127) {
+    if (!file->put ((unsigned char) (128 | (n & 127))))
+      return false;
+    n >>= 7;
+  }
+  return file->put ((unsigned char) n);
+}
+
+bool Image::put_int (int n) {
+  const uint64_t idx = n < 0 ? -(int64_t) n : n;
+  return put (2 * idx + (n < 0));
+}
+
+bool Image::put_double (double d) {
+  uint64_t bits;
+  static_assert (sizeof bits == sizeof d, "unexpected size of 'double'");
+  memcpy (&bits, &d, sizeof bits);
+  return put (bits);
+}
+
+bool Image::put_string (const char *s) {
+  if (!put ((uint64_t) strlen (s)))
+    return false;
+  for (const char *p = s; *p; p++)
+    if (!file->put (*p))
+      return false;
+  return true;
+}
+
+bool Image::get (uint64_t &res) {
+  res = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    const int ch = file->get ();
+    if (ch == EOF)
+      return false;
+    res |= (uint64_t) (ch & 127) << shift;
+    if (!(ch & 128))
+      return true;
+  }
+  return false;
+}
+
+bool Image::get_int (int &res) {
+  uint64_t n;
+  if (!get (n))
+    return false;
+  const uint64_t idx = n / 2;
+  if (idx > (uint64_t) INT_MAX)
+    return false;
+  res = (n & 1) ? -(int) idx : (int) idx;
+  return true;
+}
+
+bool Image::get_double (double &res) {
+  uint64_t bits;
+  if (!get (bits))
+    return false;
+  memcpy (&res, &bits, sizeof res);
+  return true;
+}
+
+bool Image::get_string (string &res) {
+  uint64_t len;
+  if (!get (len))
+    return false;
+  res.clear ();
+  while (len--) {
+    const int ch = file->get ();
+    if (ch == EOF)
+      return false;
+    res.push_back ((char) ch);
+  }
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Bits of the flags byte of a variable in the image.
+
+enum {
+  IMAGE_ACTIVE = 1,
+  IMAGE_ELIM = 2,
+  IMAGE_SUBSUME = 4,
+  IMAGE_TERNARY = 8,
+  IMAGE_BLOCK = 16,
+};
+
+bool External::write_image_variables (Image &image) const {
+  vector<uint64_t> position (internal->max_var + 1, 0);
+  uint64_t pos = 0;
+  for (int idx = internal->queue.first; idx;
+       idx = internal->links[idx].next)
+    position[idx] = ++pos;
+  if (!image.put_double (internal->score_inc))
+    return false;
+  for (int eidx = 1; eidx <= max_var; eidx++) {
+    const int ilit = e2i[eidx];
+    if (!ilit || !internal->active (ilit)) {
+      if (!image.put ((uint64_t) 0))
+        return false;
+      continue;
+    }
+    assert (ilit != INT_MIN);
+    const int idx = abs (ilit);
+    const Flags &f = internal->flags (idx);
+    unsigned bits = IMAGE_ACTIVE;
+    if (f.elim)
+      bits |= IMAGE_ELIM;
+    if (f.subsume)
+      bits |= IMAGE_SUBSUME;
+    if (f.ternary)
+      bits |= IMAGE_TERNARY;
+    if (f.block)
+      bits |= IMAGE_BLOCK;
+    const int phase = internal->phases.saved[idx];
+    if (!image.put ((uint64_t) bits) ||
+        !image.put_int (ilit < 0 ? -phase : phase) ||
+        !image.put (position[idx]) ||
+        !image.put_double (internal->stab[idx]))
+      return false;
+  }
+  return true;
+}
+
+// Variables which are not active in the loading solver (for instance
+// units) still have their data read but it is ignored.  The queue and the
+// heap are rebuilt afterwards from the read positions and scores.
+
+bool External::read_image_variables (Image &image, int vars) {
+  vector<uint64_t> position (internal->max_var + 1, 0);
+  double score_inc;
+  if (!image.get_double (score_inc))
+    return false;
+  internal->score_inc = score_inc;
+  for (int eidx = 1; eidx <= vars; eidx++) {
+    uint64_t bits;
+    if (!image.get (bits))
+      return false;
+    if (!bits)
+      continue;
+    int phase;
+    uint64_t pos;
+    double score;
+    if (!image.get_int (phase) || phase < -1 || phase > 1 ||
+        !image.get (pos) || !image.get_double (score))
+      return false;
+    if (eidx > max_var)
+      return false;
+    const int ilit = e2i[eidx];
+    if (!ilit || !internal->active (ilit))
+      continue;
+    const int idx = abs (ilit);
+    Flags &f = internal->flags (idx);
+    f.elim = bits & IMAGE_ELIM;
+    f.subsume = bits & IMAGE_SUBSUME;
+    f.ternary = bits & IMAGE_TERNARY;
+    f.block = bits & IMAGE_BLOCK;
+    internal->phases.saved[idx] = ilit < 0 ? -phase : phase;
+    internal->stab[idx] = score;
+    position[idx] = pos;
+  }
+
+  // Variables without position (zero) are put in front of the queue.
+
+  internal->reorder_queue (position);
+  internal->rebuild_scores ();
+
+  return true;
+}
+
+} // namespace CaDiCaL
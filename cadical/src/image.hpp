@@ -0,0 +1,36 @@
+#ifndef _image_hpp_INCLUDED
+#define _image_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+class File;
+
+// Binary solver images written by 'Solver::save_snapshot' and read back by
+// 'Solver::load_snapshot' (see 'image.cpp' for the layout).  Unsigned
+// numbers use the variable length encoding of binary DRAT (seven bits per
+// byte, least significant first, high bit set if more bytes follow).
+// Signed numbers and literals are mapped to '2*abs(n) + (n < 0)' first and
+// scores are written as the bit pattern of their 'double' value.
+
+class Image {
+  File *file;
+
+public:
+  static const char *magic; // Header line including format version.
+
+  Image (File *f) : file (f) {}
+
+  bool put (uint64_t);
+  bool put_int (int);
+  bool put_double (double);
+  bool put_string (const char *);
+
+  bool get (uint64_t &);
+  bool get_int (int &);
+  bool get_double (double &);
+  bool get_string (string &);
+};
+
+} // namespace CaDiCaL
+
+#endif
@@ -111,7 +111,7 @@ bool Internal::inst_propagate () { // Adapted from 'propagate'.
         lits[0] = other, lits[1] = lit;
         const signed char u = val (other);
         if (u > 0)
-          j[-1].blit = other;
+          j[-1].update_blit (other);
         else {
           const int size = w.clause->size;
           const const_literal_iterator end = lits + size;
@@ -130,7 +130,7 @@ bool Internal::inst_propagate () { // Adapted from 'propagate'.
           w.clause->pos = k - lits;
           assert (lits + 2 <= k), assert (k <= w.clause->end ());
           if (v > 0) {
-            j[-1].blit = r;
+            j[-1].update_blit (r);
           } else if (!v) {
             LOG (w.clause, "unwatch %d in", r);
             lits[1] = r;
@@ -8,14 +8,18 @@ static Clause external_reason_clause;
 Internal::Internal ()
     : mode (SEARCH), unsat (false), iterating (false),
       localsearching (false), lookingahead (false), preprocessing (false),
-      protected_reasons (false), force_saved_phase (false),
+      protected_reasons (false), keeping_occs (false),
+      force_saved_phase (false),
       searching_lucky_phases (false), stable (false), reported (false),
       external_prop (false), did_external_prop (false),
       external_prop_is_lazy (true), forced_backt_allowed (false), 
       private_steps (false), rephased (0), vsize (0), max_var (0), 
       clause_id (0), original_id (0), reserved_ids (0), 
-      conflict_id (0), concluded (false), lrat (false), level (0), vals (0),
-      score_inc (1.0), scores (this), conflict (0), ignore (0),
+      conflict_id (0), concluded (false), lrat (false), level (0),
+      pages (this), vals (0),
+      simd_search (simd_non_false_literal_search ()),
+      links (&pages), score_inc (1.0), scores (this), vtab (&pages),
+      wtab (&pages), conflict (0), ignore (0),
       external_reason (&external_reason_clause), newest_clause (0),
       force_no_backtrack (false), from_propagator (false), ext_clause_forgettable (false),
       tainted_literal (0), notified (0), probe_reason (0), propagated (0),
@@ -26,7 +30,7 @@ Internal::Internal ()
 #ifndef QUIET
       profiles (this), force_phase_messages (false),
 #endif
-      arena (this), prefix ("c "), internal (this), external (0),
+      arena (this), slab (this), prefix ("c "), internal (this), external (0),
       termination_forced (false), vars (this->max_var),
       lits (this->max_var) {
   control.push_back (Level (0, 0));
@@ -52,7 +56,7 @@ Internal::~Internal () {
     delete stattracer;
   if (vals) {
     vals -= vsize;
-    delete[] vals;
+    deallocate_pages (&pages, vals, 2u * vsize + simd_vals_padding);
   }
 }
 
@@ -78,28 +82,31 @@ static signed char *ignore_clang_analyze_memory_leak_warning;
 
 void Internal::enlarge_vals (size_t new_vsize) {
   signed char *new_vals;
-  const size_t bytes = 2u * new_vsize;
-  new_vals = new signed char[bytes]; // g++-4.8 does not like ... { 0 };
+  const size_t bytes = 2u * new_vsize + simd_vals_padding;
+  new_vals = (signed char *) allocate_pages (&pages, bytes);
   memset (new_vals, 0, bytes);
   ignore_clang_analyze_memory_leak_warning = new_vals;
   new_vals += new_vsize;
 
   if (vals)
     memcpy (new_vals - max_var, vals - max_var, 2u * max_var + 1u);
-  vals -= vsize;
-  delete[] vals;
+  if (vals) {
+    vals -= vsize;
+    deallocate_pages (&pages, vals, 2u * vsize + simd_vals_padding);
+  }
   vals = new_vals;
 }
 
 /*------------------------------------------------------------------------*/
 
-template <class T>
-static void enlarge_init (vector<T> &v, size_t N, const T &i) {
+template <class T, class A>
+static void enlarge_init (vector<T, A> &v, size_t N, const T &i) {
   if (v.size () < N)
     v.resize (N, i);
 }
 
-template <class T> static void enlarge_only (vector<T> &v, size_t N) {
+template <class T, class A>
+static void enlarge_only (vector<T, A> &v, size_t N) {
   if (v.size () < N)
     v.resize (N, T ());
 }
@@ -280,15 +287,15 @@ int Internal::cdcl_loop_with_inprocessing () {
     else if (reducing ())
       reduce (); // collect useless clauses
     else if (probing ())
-      probe (); // failed literal probing
+      inprocess (&Internal::probe); // failed literal probing
     else if (subsuming ())
-      subsume (); // subsumption algorithm
+      inprocess (&Internal::subsume); // subsumption algorithm
     else if (eliminating ())
-      elim (); // variable elimination
+      inprocess (&Internal::elim); // variable elimination
     else if (compacting ())
       compact (); // collect variables
     else if (conditioning ())
-      condition (); // globally blocked clauses
+      inprocess (&Internal::condition); // globally blocked clauses
     else
       res = decide (); // next decision
   }
@@ -722,6 +729,7 @@ int Internal::local_search () {
 int Internal::solve (bool preprocess_only) {
   assert (clause.empty ());
   START (solve);
+  init_latency ();
   if (proof)
     proof->solve_query ();
   if (opts.ilb) {
@@ -768,6 +776,7 @@ int Internal::solve (bool preprocess_only) {
   finalize (res);
   reset_solving ();
   report_solving (res);
+  record_latency_histograms ();
   STOP (solve);
   return res;
 }
@@ -67,6 +67,7 @@ extern "C" {
 #include "frattracer.hpp"
 #include "heap.hpp"
 #include "idruptracer.hpp"
+#include "image.hpp"
 #include "instantiate.hpp"
 #include "internal.hpp"
 #include "level.hpp"
@@ -79,8 +80,11 @@ extern "C" {
 #include "message.hpp"
 #include "occs.hpp"
 #include "options.hpp"
+#include "pages.hpp"
+#include "parallel.hpp"
 #include "parse.hpp"
 #include "phases.hpp"
+#include "probe.hpp"
 #include "profile.hpp"
 #include "proof.hpp"
 #include "queue.hpp"
@@ -91,8 +95,13 @@ extern "C" {
 #include "reluctant.hpp"
 #include "resources.hpp"
 #include "score.hpp"
+#include "simd.hpp"
+#include "slab.hpp"
+#include "snapshot.hpp"
 #include "stats.hpp"
+#include "subsume.hpp"
 #include "terminal.hpp"
+#include "tier.hpp"
 #include "tracer.hpp"
 #include "util.hpp"
 #include "var.hpp"
@@ -166,6 +175,7 @@ struct Internal {
   bool lookingahead;           // true during look ahead
   bool preprocessing;          // true during preprocessing
   bool protected_reasons;      // referenced reasons are protected
+  bool keeping_occs;           // keep occurrence lists between rounds
   bool force_saved_phase;      // force saved phase in decision
   bool searching_lucky_phases; // during 'lucky_phases'
   bool stable;                 // true during stabilization phase
@@ -196,7 +206,9 @@ struct Internal {
   bool lrat;                    // generate LRAT internally
   int level;                    // decision level ('control.size () - 1')
   Phases phases;                // saved, target and best phases
+  Pages pages;                  // allocation of large tables
   signed char *vals;            // assignment [-max_var,max_var]
+  non_false_literal_search simd_search; // vectorized (if supported)
   vector<signed char> marks;    // signed marks [1,max_var]
   vector<unsigned> frozentab;   // frozen counters [1,max_var]
   vector<int> i2e;              // maps internal 'idx' to external 'lit'
@@ -206,16 +218,20 @@ struct Internal {
   double score_inc;             // current score increment
   ScoreSchedule scores;         // score based decision priority queue
   vector<double> stab;          // table of variable scores [1,max_var]
-  vector<Var> vtab;             // variable table [1,max_var]
+  vector<Var, PageAllocator<Var>> vtab; // variable table [1,max_var]
   vector<int> parents;          // parent literals during probing
   vector<Flags> ftab;           // variable and literal flags
   vector<int64_t> btab;         // enqueue time stamps for queue
   vector<int64_t> gtab;         // time stamp table to recompute glue
   vector<Occs> otab;            // table of occurrences for all literals
+  vector<Occs> ktab;            // kept occurrences between rounds
+  vector<int> stale;            // literals with stale kept occurrences
   vector<int> ptab;             // table for caching probing attempts
   vector<int64_t> ntab;         // number of one-sided occurrences table
   vector<Bins> big;             // binary implication graph
-  vector<Watches> wtab;         // table of watches for all literals
+  BinaryGraph bingraph;         // same in CSR format (see 'bins.cpp')
+  vector<Watches, PageAllocator<Watches>>
+      wtab;                     // table of watches for all literals
   Clause *conflict;             // set in 'propagation', reset in 'analyze'
   Clause *ignore;               // ignored during 'vivify_propagate'
   Clause *dummy_binary;         // Dummy binary clause for subsumption
@@ -253,6 +269,7 @@ struct Internal {
   vector<int> probes;       // remaining scheduled probes
   vector<Level> control;    // 'level + 1 == control.size ()'
   vector<Clause *> clauses; // ordered collection of all clauses
+  Tiers tiers;              // redundant clauses per tier
   Averages averages;        // glue, size, jump moving averages
   Limit lim;                // limits for various phases
   Last last;                // statistics at last occurrence
@@ -273,6 +290,7 @@ struct Internal {
   bool force_phase_messages; // force 'phase (...)' messages
 #endif
   Arena arena;          // memory arena for moving garbage collector
+  Slab slab;            // allocator for clauses outside of the arena
   Format error_message; // provide persistent error message
   string prefix;        // verbose messages prefix
 
@@ -507,13 +525,28 @@ struct Internal {
   void unmark_clause (); // unmark 'this->clause'
   void unmark (Clause *);
 
+  // Watch of 'lit' in clause with blocking literal 'blit'.  For ternary
+  // clauses the remaining literal is inlined (see 'watch.hpp').
+  //
+  inline Watch new_watch (int lit, int blit, Clause *c) {
+    if (c->size == 3 && opts.inlineternary) {
+      const int *lits = c->literals;
+      const int third = lits[0] ^ lits[1] ^ lits[2] ^ lit ^ blit;
+      assert (third != lit), assert (third != blit);
+      assert (third == lits[0] || third == lits[1] || third == lits[2]);
+      if (Watch::inlinable (third))
+        return Watch (blit, third, c);
+    }
+    return Watch (blit, c);
+  }
+
   // Watch literal 'lit' in clause with blocking literal 'blit'.
   // Inlined here, since it occurs in the tight inner loop of 'propagate'.
   //
   inline void watch_literal (int lit, int blit, Clause *c) {
     assert (lit != blit);
     Watches &ws = watches (lit);
-    ws.push_back (Watch (blit, c));
+    ws.push_back (new_watch (lit, blit, c));
     LOG (c, "watch %d blit %d in", lit, blit);
   }
 
@@ -562,6 +595,8 @@ struct Internal {
   // these functions work on the global temporary 'clause'.
   //
   Clause *new_clause (bool red, int glue = 0);
+  void tier_clause (Clause *);
+  void mark_hyper (Clause *);
   void promote_clause (Clause *, int new_glue);
   size_t shrink_clause (Clause *, int new_size);
   void minimize_sort_clause ();
@@ -720,6 +755,8 @@ struct Internal {
   char rephase_walk ();
   void shuffle_scores ();
   void shuffle_queue ();
+  void reorder_queue (const vector<uint64_t> &position);
+  void rebuild_scores ();
   void rephase ();
 
   // Lucky feasible case checking.
@@ -740,6 +777,14 @@ struct Internal {
 
   bool search_limits_hit ();
 
+  // Latency budget for inprocessing in 'latency.cpp'.
+  //
+  void init_latency ();
+  void inprocess (void (Internal::*) (bool));
+  bool inprocessing_suspended ();
+  void suspend_inprocessing ();
+  void record_latency_histograms ();
+
   void terminate () {
     LOG ("forcing asynchronous termination");
     termination_forced = true;
@@ -753,6 +798,8 @@ struct Internal {
   bool reducing ();
   void protect_reasons ();
   void mark_clauses_to_be_flushed ();
+  void collect_local_clauses (vector<Clause *> &candidates);
+  void demote_tier2_clauses (vector<Clause *> &candidates);
   void mark_useless_redundant_clauses_as_garbage ();
   bool propagate_out_of_order_units ();
   void unprotect_reasons ();
@@ -766,9 +813,11 @@ struct Internal {
   void mark_satisfied_clauses_as_garbage ();
   void copy_clause (Clause *);
   void flush_watches (int lit, Watches &);
-  size_t flush_occs (int lit);
+  size_t flush_occs (Occs &);
+  size_t flush_occs (int lit) { return flush_occs (occs (lit)); }
   void flush_all_occs_and_watches ();
   void update_reason_references ();
+  void flush_tiers ();
   void copy_non_garbage_clauses ();
   void delete_garbage_clauses ();
   void check_clause_stats ();
@@ -785,9 +834,27 @@ struct Internal {
   void init_bins ();
   void init_noccs ();
   void reset_occs ();
+  void connect_occs ();
+  void rebuild_occs ();
+  void update_occs ();
+  void flush_stale_occs (int lit);
+  void keep_occs ();
+  void clear_stale_occs ();
+  void drop_kept_occs ();
+#ifndef NDEBUG
+  void check_occs ();
+#endif
   void reset_bins ();
   void reset_noccs ();
 
+  // Shared binary implication graph in 'bins.cpp'.
+  //
+  void init_binary_graph ();
+  const BinaryGraph &binary_graph ();
+  bool binary_graph_usable () const;
+  void binary_graph_changed (Clause *);
+  void reset_binary_graph ();
+
   // Operators on watches.
   //
   void init_watches ();
@@ -802,7 +869,18 @@ struct Internal {
   void strengthen_clause (Clause *, int);
   void subsume_clause (Clause *subsuming, Clause *subsumed);
   int subsume_check (Clause *subsuming, Clause *subsumed);
-  int try_to_subsume_clause (Clause *, vector<Clause *> &shrunken);
+  int try_to_subsume_clause (Subsumer &, Clause *,
+                             vector<Clause *> &shrunken);
+  int subsume_or_strengthen (Clause *, Clause *, int flipped,
+                             vector<Clause *> &shrunken);
+  void subsume_check_candidate (Subsumer &, Clause *, SubsumeCandidate &,
+                                vector<signed char> &marks);
+  void subsume_shard (Subsumer &, const vector<ClauseSize> &,
+                      size_t begin, size_t end);
+  void subsume_shard_connect (Subsumer &, int lit);
+  int subsume_shard_candidate (Subsumer &, Clause *,
+                               const SubsumeCandidate &,
+                               vector<Clause *> &shrunken);
   void reset_subsume_bits ();
   bool subsume_round ();
   void subsume (bool update_limits = true);
@@ -818,6 +896,10 @@ struct Internal {
   int64_t cover_round ();
   bool cover ();
 
+  // Read-only clause snapshot for worker threads in 'snapshot.cpp'.
+  //
+  void init_snapshot (Snapshot &, bool only_kept);
+
   // Strengthening through vivification in 'vivify.cpp'.
   //
   void flush_vivification_schedule (Vivifier &);
@@ -832,6 +914,15 @@ struct Internal {
   void vivify_assume (int lit);
   bool vivify_propagate ();
   void vivify_clause (Vivifier &, Clause *candidate);
+  void vivify_parallel_analyze (SnapshotWorker &, int start, bool &);
+  void vivify_parallel_post_process (SnapshotWorker &, Clause *candidate,
+                                     int subsume, vector<int> &clause);
+  void vivify_parallel_justify (SnapshotWorker &, int lit, Clause *reason,
+                                VivifyResult &);
+  void vivify_parallel_clause (SnapshotWorker &, Clause *candidate,
+                               VivifyResult &);
+  void vivify_parallel_commit (Clause *candidate, VivifyResult &);
+  void vivify_parallel (Vivifier &, int64_t limit);
   void vivify_round (bool redundant_mode, int64_t delta);
   void vivify ();
 
@@ -899,6 +990,23 @@ struct Internal {
   // clause elimination it is better to have a more precise signed version,
   // which allows to independently mark positive and negative literals.
   //
+  // While occurrence lists are kept between rounds of an elimination
+  // phase, removing clauses or literals makes occurrence lists stale and
+  // new irredundant clauses have to be connected later (see 'occs.cpp').
+  //
+  void mark_stale (int lit) {
+    Flags &f = flags (lit);
+    const unsigned bit = bign (lit);
+    if (f.stale & bit)
+      return;
+    f.stale |= bit;
+    stale.push_back (lit);
+  }
+  void mark_dirty (Clause *c) {
+    if (!ktab.empty ())
+      c->dirty = true;
+  }
+
   void mark_elim (int lit) {
     Flags &f = flags (lit);
     if (f.elim)
@@ -919,6 +1027,8 @@ struct Internal {
   void mark_removed (int lit) {
     mark_elim (lit);
     mark_block (-lit);
+    if (keeping_occs)
+      mark_stale (lit);
   }
   void mark_removed (Clause *, int except = 0);
 
@@ -1028,7 +1138,13 @@ struct Internal {
   void elim_backward_clauses (Eliminator &);
   void elim_propagate (Eliminator &, int unit);
   void elim_on_the_fly_self_subsumption (Eliminator &, Clause *, int);
-  void try_to_eliminate_variable (Eliminator &, int pivot);
+  void try_to_eliminate_variable (Eliminator &, int pivot,
+                                  const ElimCandidate * = 0);
+  bool elim_mark_neighbours (Eliminator &, int pivot);
+  void elim_check_candidate (ElimCandidate &, vector<signed char> &marks);
+  bool elim_reuse_candidate (Eliminator &, const ElimCandidate &,
+                             bool &bounded);
+  int64_t elim_independent_set (Eliminator &, int64_t resolution_limit);
   void increase_elimination_bound ();
   int elim_round (bool &completed);
   void elim (bool update_limits = true);
@@ -1079,6 +1195,17 @@ struct Internal {
   void generate_probes ();
   void flush_probes ();
   int next_probe ();
+  void probe_parallel_sync (ProbeWorker &);
+  void probe_parallel_justify (ProbeWorker &, int dom, int reason,
+                               vector<uint64_t> &chain,
+                               vector<Clause *> &antecedents);
+  void probe_parallel_hyper (ProbeWorker &, int reason, int dom, int lit,
+                             ProbeResult &);
+  bool probe_parallel_propagate (ProbeWorker &, ProbeResult &);
+  void probe_parallel_literal (ProbeWorker &, int probe, ProbeResult &);
+  bool probe_parallel_stale (const vector<Clause *> &antecedents);
+  void probe_parallel_commit (int probe, ProbeResult &, int64_t fixed);
+  void probe_parallel (int64_t limit);
   bool probe_round ();
   void probe (bool update_limits = true);
 
@@ -1368,6 +1495,10 @@ struct Internal {
   //
   bool traverse_constraint (ClauseIterator &);
 
+  // Copy irredundant and redundant clauses directly into a fresh solver.
+  //
+  void clone_clauses (Internal &other);
+
   /*----------------------------------------------------------------------*/
 
   double solve_time (); // accumulated time spent in 'solve ()'
@@ -1558,6 +1689,29 @@ inline bool Internal::terminated_asynchronously (int factor) {
 
 /*------------------------------------------------------------------------*/
 
+// Checked by inprocessing loops together with 'terminated_asynchronously'
+// and by the inprocessing triggers (see 'latency.cpp').  Since calling
+// 'time' is costly we only check the time every 'opts.latencyint' calls.
+
+inline bool Internal::inprocessing_suspended () {
+  if (!opts.latency)
+    return false;
+  if (lim.latency.suspended)
+    return true;
+  if (lim.latency.started < 0)
+    return false;
+  if (lim.latency.check--)
+    return false;
+  lim.latency.check = opts.latencyint;
+  const double spent = lim.latency.spent + time () - lim.latency.started;
+  if (spent < 1e-3 * opts.latency)
+    return false;
+  suspend_inprocessing ();
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
 inline bool Internal::search_limits_hit () {
   assert (!preprocessing);
   assert (!localsearching);
@@ -0,0 +1,78 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// In incremental usage with many short 'solve' calls a single inprocessing
+// phase (probing, subsumption and vivification, variable elimination or
+// globally blocked clause elimination) can dominate the latency of a call.
+// With 'opts.latency' (in milliseconds) the time spent in inprocessing
+// during one 'solve' call is bounded.  The main loops of these phases check
+// 'inprocessing_suspended' together with 'terminated_asynchronously'.  If
+// the budget is exhausted they stop early and keep their remaining schedule
+// for later: probes remain on the 'probes' stack, clauses not vivified yet
+// or not tried for subsumption keep their 'vivify' and 'subsume' flags and
+// remaining variable elimination candidates their 'elim' flag.  Further
+// inprocessing is not triggered anymore in this call and since the limits
+// of a suspended phase are not updated it resumes in the next call.
+
+// Independent of the budget we collect histograms of the latency of 'solve'
+// calls and of the time spent in inprocessing per call.
+
+void Internal::init_latency () {
+  lim.latency.solve = time ();
+  lim.latency.started = -1;
+  lim.latency.spent = 0;
+  lim.latency.check = 0;
+  lim.latency.suspended = false;
+}
+
+void Internal::inprocess (void (Internal::*phase) (bool)) {
+  assert (lim.latency.started < 0);
+  lim.latency.started = time ();
+  lim.latency.check = opts.latencyint;
+  (this->*phase) (true);
+  const double now = time ();
+  lim.latency.spent += now - lim.latency.started;
+  lim.latency.started = -1;
+  if (!opts.latency || lim.latency.suspended)
+    return;
+  if (lim.latency.spent < 1e-3 * opts.latency)
+    return;
+  suspend_inprocessing ();
+}
+
+void Internal::suspend_inprocessing () {
+  assert (opts.latency);
+  assert (!lim.latency.suspended);
+  lim.latency.suspended = true;
+  stats.latency.suspended++;
+  VERBOSE (3,
+           "suspending inprocessing after %.0f ms "
+           "(latency budget %d ms)",
+           1e3 * (lim.latency.spent + (lim.latency.started < 0
+                                           ? 0
+                                           : time () - lim.latency.started)),
+           opts.latency);
+}
+
+// Bucket 'i' counts latencies in the interval '[2^(i-1),2^i)' milliseconds,
+// where the first bucket is for latencies below one millisecond and the
+// last one collects all larger latencies.
+
+static void record_latency (int64_t *histogram, double seconds) {
+  double ms = 1e3 * seconds;
+  int bucket = 0;
+  while (ms >= 1 && bucket + 1 < Stats::latency_buckets)
+    ms /= 2, bucket++;
+  histogram[bucket]++;
+}
+
+void Internal::record_latency_histograms () {
+  stats.latency.calls++;
+  record_latency (stats.latency.solve, time () - lim.latency.solve);
+  record_latency (stats.latency.inprocessing, lim.latency.spent);
+}
+
+} // namespace CaDiCaL
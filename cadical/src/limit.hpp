@@ -40,6 +40,16 @@ struct Limit {
     int forced; // forced termination for testing
   } terminate;
 
+  // Inprocessing latency budget of the current 'solve' call.
+  //
+  struct {
+    double solve;   // start time of 'solve' call
+    double started; // start time of inprocessing phase (or negative)
+    double spent;   // inprocessing time spent in this call
+    int check;      // countdown to next time check
+    bool suspended; // budget exhausted and inprocessing suspended
+  } latency;
+
   Limit ();
 };
 
@@ -382,6 +382,8 @@ int Internal::lookahead_probing () {
       sort_watches ();
   }
 
+  reset_binary_graph ();
+
 #ifndef QUIET
   int failed = stats.failed - old_failed;
   int64_t probed = stats.probed - old_probed;
@@ -20,6 +20,150 @@ void Internal::reset_occs () {
 
 /*------------------------------------------------------------------------*/
 
+// Bounded variable elimination ('elim_round') and blocked clause
+// elimination ('block') need full occurrence lists of irredundant clauses.
+// In an elimination phase these rounds alternate with other rounds, e.g.,
+// subsumption, which usually only change few clauses.  Thus with
+// 'opts.elimoccs' the occurrence lists are not reset at the end of a
+// round but kept in 'ktab' ('keep_occs') and updated at the beginning of
+// the next round ('update_occs') instead of rebuilding them from scratch.
+
+// While the occurrence lists are kept the literals of removed clauses and
+// removed literals of strengthened clauses are pushed on the 'stale' stack
+// (see 'mark_removed') and only the occurrence lists of those literals are
+// flushed.  Irredundant clauses added or made irredundant in the mean time
+// are marked 'dirty' and connected.  Garbage collection flushes the kept
+// occurrence lists too (see 'flush_all_occs_and_watches').
+
+void Internal::connect_occs () {
+  if (ktab.empty ())
+    rebuild_occs ();
+  else
+    update_occs ();
+}
+
+void Internal::rebuild_occs () {
+  START (rebuildoccs);
+  stats.occs.rebuilt++;
+  clear_stale_occs ();
+  init_occs ();
+  for (const auto &c : clauses)
+    if (!c->garbage && !c->redundant)
+      for (const auto &lit : *c)
+        if (active (lit))
+          occs (lit).push_back (c);
+  LOG ("rebuilt occurrence lists");
+  STOP (rebuildoccs);
+}
+
+// Remove garbage clauses and clauses which do not contain 'lit' anymore.
+
+void Internal::flush_stale_occs (int lit) {
+  Occs &os = occs (lit);
+  auto j = os.begin ();
+  for (const auto &c : os) {
+    if (c->garbage || c->redundant)
+      continue;
+    if (find (c->begin (), c->end (), lit) == c->end ())
+      continue;
+    *j++ = c;
+  }
+  os.resize (j - os.begin ());
+}
+
+void Internal::update_occs () {
+  START (updateoccs);
+  stats.occs.updated++;
+  assert (!occurring ());
+  otab.swap (ktab);
+  assert (ktab.empty ());
+  for (const auto &lit : stale) {
+    Flags &f = flags (lit);
+    f.stale &= ~bign (lit);
+    if (!active (lit))
+      continue;
+    flush_stale_occs (lit);
+    stats.occs.flushed++;
+  }
+  stale.clear ();
+  for (auto lit : lits)
+    if (!active (lit) && !occs (lit).empty ())
+      erase_occs (occs (lit));
+  for (const auto &c : clauses) {
+    if (!c->dirty)
+      continue;
+    c->dirty = false;
+    if (c->garbage || c->redundant)
+      continue;
+    for (const auto &lit : *c)
+      if (active (lit))
+        occs (lit).push_back (c);
+    stats.occs.connected++;
+  }
+  LOG ("updated kept occurrence lists");
+  STOP (updateoccs);
+#ifndef NDEBUG
+  check_occs ();
+#endif
+}
+
+void Internal::keep_occs () {
+  if (!keeping_occs) {
+    reset_occs ();
+    return;
+  }
+  assert (ktab.empty ());
+  otab.swap (ktab);
+  LOG ("keeping occurrence lists");
+}
+
+void Internal::clear_stale_occs () {
+  for (const auto &lit : stale)
+    flags (lit).stale &= ~bign (lit);
+  stale.clear ();
+}
+
+// Called at the end of an elimination phase.
+
+void Internal::drop_kept_occs () {
+  keeping_occs = false;
+  clear_stale_occs ();
+  if (ktab.empty ())
+    return;
+  erase_vector (ktab);
+  for (const auto &c : clauses)
+    c->dirty = false;
+  LOG ("dropped kept occurrence lists");
+}
+
+#ifndef NDEBUG
+
+// Check that updated occurrence lists contain exactly the non-garbage
+// irredundant clauses on their active literals.
+
+void Internal::check_occs () {
+  vector<int64_t> count (2 * vsize, 0);
+  for (const auto &c : clauses)
+    if (!c->garbage && !c->redundant)
+      for (const auto &lit : *c)
+        if (active (lit))
+          count[vlit (lit)]++;
+  for (auto lit : lits) {
+    int64_t connected = 0;
+    for (const auto &c : occs (lit)) {
+      assert (!c->garbage);
+      assert (!c->redundant);
+      assert (find (c->begin (), c->end (), lit) != c->end ());
+      connected++;
+    }
+    assert (connected == count[vlit (lit)]);
+  }
+}
+
+#endif
+
+/*------------------------------------------------------------------------*/
+
 // One-sided occurrence counter (each literal has its own counter).
 
 void Internal::init_noccs () {
@@ -0,0 +1,159 @@
+#include "internal.hpp"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+#ifdef __linux__
+/*------------------------------------------------------------------------*/
+
+static size_t huge_pages_bytes (size_t bytes) {
+  const size_t mask = huge_page_bytes - 1;
+  return (bytes + mask) & ~mask;
+}
+
+// Map 'bytes' (a multiple of the huge page size) aligned to huge pages by
+// mapping one huge page more and unmapping the unaligned head and tail.
+
+static void *map_aligned (size_t bytes) {
+  const size_t extended = bytes + huge_page_bytes;
+  void *p = mmap (0, extended, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p == MAP_FAILED)
+    return 0;
+  char *start = (char *) p;
+  char *aligned = (char *) huge_pages_bytes ((size_t) start);
+  if (aligned > start)
+    munmap (start, aligned - start);
+  char *end = aligned + bytes;
+  if (end < start + extended)
+    munmap (end, start + extended - end);
+  return aligned;
+}
+
+// Prefer the NUMA node of the CPU the current thread runs on.  We use the
+// system calls directly to avoid depending on 'libnuma'.
+
+static bool bind_to_current_node (void *p, size_t bytes) {
+#if defined(SYS_getcpu) && defined(SYS_mbind)
+  unsigned cpu, node;
+  if (syscall (SYS_getcpu, &cpu, &node, (void *) 0))
+    return false;
+  const size_t bits = 8 * sizeof (unsigned long);
+  unsigned long mask[16] = {0};
+  if (node >= 16 * bits)
+    return false;
+  mask[node / bits] = 1ul << (node % bits);
+  const int MPOL_PREFERRED = 1;
+  return !syscall (SYS_mbind, p, bytes, MPOL_PREFERRED, mask,
+                   (unsigned long) (16 * bits), 0u);
+#else
+  (void) p, (void) bytes;
+  return false;
+#endif
+}
+
+void *Pages::allocate (size_t bytes) {
+  const size_t mapped = huge_pages_bytes (bytes);
+  const int hugepages = internal->opts.hugepages;
+  void *res = 0;
+  int placement = REGULAR;
+#ifdef MAP_HUGETLB
+  if (hugepages > 1) {
+    res = mmap (0, mapped, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (res == MAP_FAILED)
+      res = 0;
+    else
+      placement = HUGETLB;
+  }
+#endif
+  if (!res) {
+    res = map_aligned (mapped);
+    if (!res)
+      throw std::bad_alloc ();
+#ifdef MADV_HUGEPAGE
+    if (hugepages && !madvise (res, mapped, MADV_HUGEPAGE))
+      placement = TRANSPARENT;
+#endif
+  }
+  if (internal->opts.numa && bind_to_current_node (res, mapped))
+    placement |= BOUND;
+  placed[res] = placement;
+  account (placement, mapped, 1);
+  LOG ("mapped %zu bytes at %p with placement %d", mapped, res,
+       placement);
+  return res;
+}
+
+void Pages::deallocate (void *p, size_t bytes) {
+  const size_t mapped = huge_pages_bytes (bytes);
+  auto it = placed.find (p);
+  if (it != placed.end ()) {
+    account (it->second, mapped, -1);
+    placed.erase (it);
+  }
+  LOG ("unmapping %zu bytes at %p", mapped, p);
+  munmap (p, mapped);
+}
+
+void Pages::account (int placement, size_t bytes, int sign) {
+  const int64_t delta = sign * (int64_t) bytes;
+  auto &stats = internal->stats.pages;
+  stats.mapped += delta;
+  if (placement & TRANSPARENT)
+    stats.transparent += delta;
+  if (placement & HUGETLB)
+    stats.hugetlb += delta;
+  if (placement & BOUND)
+    stats.bound += delta;
+  if (stats.mapped > stats.peak)
+    stats.peak = stats.mapped;
+}
+
+void *allocate_pages (Pages *pages, size_t bytes) {
+  if (bytes < huge_page_bytes)
+    return ::operator new (bytes);
+  if (pages)
+    return pages->allocate (bytes);
+  void *res = map_aligned (huge_pages_bytes (bytes));
+  if (!res)
+    throw std::bad_alloc ();
+  return res;
+}
+
+void deallocate_pages (Pages *pages, void *p, size_t bytes) {
+  if (bytes < huge_page_bytes)
+    ::operator delete (p);
+  else if (pages)
+    pages->deallocate (p, bytes);
+  else
+    munmap (p, huge_pages_bytes (bytes));
+}
+
+/*------------------------------------------------------------------------*/
+#else
+/*------------------------------------------------------------------------*/
+
+void *Pages::allocate (size_t bytes) { return ::operator new (bytes); }
+
+void Pages::deallocate (void *p, size_t) { ::operator delete (p); }
+
+void Pages::account (int, size_t, int) {}
+
+void *allocate_pages (Pages *, size_t bytes) {
+  return ::operator new (bytes);
+}
+
+void deallocate_pages (Pages *, void *p, size_t) { ::operator delete (p); }
+
+/*------------------------------------------------------------------------*/
+#endif
+/*------------------------------------------------------------------------*/
+
+} // namespace CaDiCaL
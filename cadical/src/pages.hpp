@@ -0,0 +1,95 @@
+#ifndef _pages_hpp_INCLUDED
+#define _pages_hpp_INCLUDED
+
+#include <cstddef>
+#include <type_traits>
+#include <unordered_map>
+
+namespace CaDiCaL {
+
+// Large tables accessed during propagation (the assignment 'vals', the
+// variable table 'vtab', the decision queue 'links', the table of watch
+// lists 'wtab' and the clause arena) are allocated through this layer.
+// Blocks of at least 'huge_page_bytes' are mapped directly (on Linux) and
+// aligned to huge pages, which then can be backed by transparent huge pages
+// ('opts.hugepages = 1') or explicitly reserved huge pages ('MAP_HUGETLB'
+// with 'opts.hugepages = 2', falling back to transparent huge pages if
+// none are available).  This reduces TLB misses on large instances.  With
+// 'opts.numa' the memory is further bound to the NUMA node of the thread
+// allocating it, which is the solving thread.  Smaller blocks are allocated
+// with 'new' as before.
+
+// Whether a block is mapped only depends on its size.  Thus memory can be
+// deallocated by any allocator, independent of the options.  The placement
+// of mapped blocks is recorded for the 'pages' statistics.
+
+struct Internal;
+
+static const size_t huge_page_bytes = (size_t) 1 << 21;
+
+class Pages {
+
+  Internal *internal;
+
+  enum Placement {
+    REGULAR = 0,
+    TRANSPARENT = 1,
+    HUGETLB = 2,
+    BOUND = 4,
+  };
+
+  std::unordered_map<void *, int> placed; // mapped block to placement
+
+  void account (int placement, size_t bytes, int sign);
+
+public:
+  Pages (Internal *i) : internal (i) {}
+
+  void *allocate (size_t bytes);
+  void deallocate (void *, size_t bytes);
+};
+
+// Allocate and deallocate through 'pages' if non-zero.
+
+void *allocate_pages (Pages *, size_t bytes);
+void deallocate_pages (Pages *, void *, size_t bytes);
+
+// Standard allocator to use this layer in vectors.  Allocators always
+// propagate with their container, such that tables keep their placement
+// policy even after being swapped (as in 'erase_vector').
+
+template <class T> class PageAllocator {
+
+  template <class U> friend class PageAllocator;
+
+  Pages *pages;
+
+public:
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+  typedef std::true_type is_always_equal;
+
+  PageAllocator (Pages *p = 0) : pages (p) {}
+  template <class U>
+  PageAllocator (const PageAllocator<U> &other) : pages (other.pages) {}
+
+  T *allocate (size_t n) {
+    return (T *) allocate_pages (pages, n * sizeof (T));
+  }
+  void deallocate (T *p, size_t n) {
+    deallocate_pages (pages, p, n * sizeof (T));
+  }
+
+  template <class U> bool operator== (const PageAllocator<U> &) const {
+    return true;
+  }
+  template <class U> bool operator!= (const PageAllocator<U> &) const {
+    return false;
+  }
+};
+
+} // namespace CaDiCaL
+
+#endif
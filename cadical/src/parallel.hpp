@@ -0,0 +1,62 @@
+#ifndef _parallel_hpp_INCLUDED
+#define _parallel_hpp_INCLUDED
+
+#include <cstddef>
+
+#ifndef NTHREADS
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+namespace CaDiCaL {
+
+// Some simplifications split part of their work into independent jobs
+// which only read the solver state and write their result into a separate
+// slot per job.  These jobs are executed here by 'threads' worker threads
+// (including the calling thread), where 'job (worker, i)' runs job 'i' on
+// worker 'worker < threads', which allows jobs to use scratch memory per
+// worker.  The results are then committed by the caller sequentially in
+// job order, which keeps simplification deterministic and independent of
+// the number of threads and their scheduling.
+
+// With one thread or if compiled with '-DNTHREADS' all jobs are executed
+// by the calling thread.  If not all threads can be started the remaining
+// jobs are executed by the ones already running.
+
+template <class Job>
+void parallel_jobs (unsigned threads, size_t jobs, Job job) {
+#ifndef NTHREADS
+  if (threads > jobs)
+    threads = jobs;
+  if (threads > 1) {
+    std::atomic<size_t> next (0);
+    auto work = [&] (unsigned worker) {
+      size_t i;
+      while ((i = next++) < jobs)
+        job (worker, i);
+    };
+    std::vector<std::thread> workers;
+    workers.reserve (threads - 1);
+    for (unsigned worker = 1; worker < threads; worker++) {
+      try {
+        workers.emplace_back (work, worker);
+      } catch (...) {
+        break;
+      }
+    }
+    work (0);
+    for (auto &worker : workers)
+      worker.join ();
+    return;
+  }
+#else
+  (void) threads;
+#endif
+  for (size_t i = 0; i < jobs; i++)
+    job (0u, i);
+}
+
+} // namespace CaDiCaL
+
+#endif
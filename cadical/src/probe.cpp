@@ -18,6 +18,8 @@ bool Internal::probing () {
     return false;
   if (!preprocessing && !opts.inprocessing)
     return false;
+  if (!preprocessing && inprocessing_suspended ())
+    return false;
   if (preprocessing)
     assert (lim.preprocessing);
   if (stats.probingphases && last.probe.reductions == stats.reductions)
@@ -261,8 +263,6 @@ inline int Internal::hyper_binary_resolve (Clause *reason) {
       clear_analyzed_literals ();
     Clause *c = new_hyper_binary_resolved_clause (red, 2);
     probe_reason = c;
-    if (red)
-      c->hyper = true;
     clause.clear ();
     lrat_chain.clear ();
     if (contained) {
@@ -381,11 +381,38 @@ inline void Internal::probe_lrat_for_units (int lit) {
 // perform hyper binary resolution and thus actually build an implication
 // tree instead of a DAG.  Statistics counters are also different.
 
+// Binary clauses are propagated over the shared binary implication graph as
+// long as no binary clause was removed.  Only for literals which obtained
+// new binary clauses (hyper binary resolvents for instance) since the graph
+// was built we have to fall back to traverse their watches.
+
 inline void Internal::probe_propagate2 () {
   require_mode (PROBE);
+  const bool usable = binary_graph_usable ();
   while (propagated2 != trail.size ()) {
     const int lit = -trail[propagated2++];
     LOG ("probe propagating %d over binary clauses", -lit);
+    const unsigned ulit = vlit (-lit);
+    if (usable && !bingraph.dirty[ulit]) {
+      const size_t end = bingraph.start[ulit + 1];
+      for (size_t i = bingraph.start[ulit]; i != end; i++) {
+        const int other = bingraph.children[i];
+        const signed char b = val (other);
+        if (b > 0)
+          continue;
+        if (b < 0)
+          conflict = bingraph.reasons[i]; // but continue
+        else {
+          assert (lrat_chain.empty ());
+          assert (!probe_reason);
+          probe_reason = bingraph.reasons[i];
+          probe_lrat_for_units (other);
+          probe_assign (other, -lit);
+          lrat_chain.clear ();
+        }
+      }
+      continue;
+    }
     Watches &ws = watches (lit);
     for (const auto &w : ws) {
       if (!w.binary ())
@@ -434,7 +461,7 @@ bool Internal::probe_propagate () {
         // lits[0] = other, lits[1] = lit;
         const signed char u = val (other);
         if (u > 0)
-          ws[j - 1].blit = other;
+          ws[j - 1].update_blit (other);
         else {
           const int size = w.clause->size;
           const const_literal_iterator end = lits + size;
@@ -453,7 +480,7 @@ bool Internal::probe_propagate () {
           w.clause->pos = k - lits;
           assert (lits + 2 <= k), assert (k <= w.clause->end ());
           if (v > 0)
-            ws[j - 1].blit = r;
+            ws[j - 1].update_blit (r);
           else if (!v) {
             LOG (w.clause, "unwatch %d in", r);
             *k = lit;
@@ -765,12 +792,349 @@ int Internal::next_probe () {
   }
 }
 
+/*------------------------------------------------------------------------*/
+
+// Parallel failed literal probing.  With 'opts.threads > 1' probes are
+// taken from the schedule in shards of 'opts.probeshard' literals.  Worker
+// threads propagate the probes of a shard on a read-only snapshot of all
+// clauses taken at the start of the round, which serves as binary
+// implication graph but also contains the large clauses (propagated by
+// counting false literals as in parallel vivification).  Each worker builds
+// the same binary implication tree on decision level one as 'probe_assign'
+// and 'hyper_binary_resolve' by using the dominator of the false literals
+// of a large forcing clause as parent.  It returns the hyper binary
+// resolvents found and, if the probe fails, the negated dominator of the
+// conflict (the UIP) with its LRAT chain.  These results are committed
+// sequentially in schedule order.  Results derived from clauses which
+// became garbage in the meantime are dropped as stale, which keeps the
+// proof valid.  Units found during the round are assigned to workers
+// before they propagate the next probe, but hyper binary resolvents are
+// not added to the snapshot.  In contrast to 'failed_literal' the parents
+// of the UIP are not tried as failed literals directly (they are only
+// found if they are probed themselves).  The result depends on the shard
+// size but not on the number of threads.
+
+// The following functions are executed by worker threads and thus only
+// read the solver state.
+
+void Internal::probe_parallel_sync (ProbeWorker &worker) {
+  assert (!worker.level);
+  const Snapshot &snapshot = *worker.snapshot;
+  while (worker.synced < trail.size ()) {
+    const int lit = trail[worker.synced++];
+    if (worker.val (lit))
+      continue;
+    const int idx = abs (lit);
+    worker.vals[Snapshot::vlit (lit)] = 1;
+    worker.vals[Snapshot::vlit (-lit)] = -1;
+    worker.levels[idx] = 0;
+    worker.reasons[idx] = -1;
+    const unsigned l = Snapshot::vlit (-lit);
+    const size_t end = snapshot.occs_start[l + 1];
+    for (size_t i = snapshot.occs_start[l]; i < end; i++)
+      worker.count[snapshot.occs[i]]++;
+  }
+}
+
+// Same as 'probe_dominator_lrat' but on the original literals of the
+// snapshot clause 'reason'.  The antecedents are always collected.
+
+void Internal::probe_parallel_justify (ProbeWorker &worker, int dom,
+                                       int reason, vector<uint64_t> &chain,
+                                       vector<Clause *> &antecedents) {
+  Clause *c = worker.snapshot->clauses[reason];
+  antecedents.push_back (c);
+  for (const auto &lit : *c) {
+    if (worker.val (lit) >= 0)
+      continue;
+    const int other = -lit;
+    if (other == dom)
+      continue;
+    const int idx = abs (other);
+    if (worker.seen[idx])
+      continue;
+    worker.seen[idx] = 1;
+    worker.analyzed.push_back (idx);
+    if (worker.levels[idx]) {
+      if (worker.reasons[idx] >= 0)
+        probe_parallel_justify (worker, dom, worker.reasons[idx], chain,
+                                antecedents);
+      continue;
+    }
+    if (lrat) {
+      const uint64_t id = unit_clauses[vlit (other)];
+      assert (id);
+      chain.push_back (id);
+    }
+  }
+  if (lrat)
+    chain.push_back (c->id);
+}
+
+// Record the hyper binary resolvent '-dom lit' of the snapshot clause
+// 'reason' as in 'hyper_binary_resolve'.
+
+void Internal::probe_parallel_hyper (ProbeWorker &worker, int reason,
+                                     int dom, int lit, ProbeResult &res) {
+  res.hypers.emplace_back ();
+  ProbeHyper &hyper = res.hypers.back ();
+  Clause *c = worker.snapshot->clauses[reason];
+  hyper.dom = dom;
+  hyper.lit = lit;
+  hyper.reason = c;
+  hyper.contained = false;
+  for (const auto &other : *c)
+    if (other == -dom)
+      hyper.contained = true;
+  probe_parallel_justify (worker, dom, reason, hyper.chain,
+                          hyper.antecedents);
+  worker.clear_analyzed ();
+}
+
+// Same as 'SnapshotWorker::propagate' but assigning parents and stopping
+// at the first conflict.  This is the counterpart of 'probe_propagate'.
+
+bool Internal::probe_parallel_propagate (ProbeWorker &worker,
+                                         ProbeResult &res) {
+  assert (worker.level == 1);
+  assert (worker.conflict < 0);
+  const Snapshot &snapshot = *worker.snapshot;
+  while (worker.conflict < 0) {
+    if (worker.propagated2 != worker.trail.size ()) {
+      const int lit = worker.trail[worker.propagated2++];
+      const unsigned l = Snapshot::vlit (-lit);
+      const size_t end = snapshot.bins_start[l + 1];
+      for (size_t i = snapshot.bins_start[l]; i < end; i++) {
+        const SnapshotBinary &bin = snapshot.bins[i];
+        const signed char b = worker.val (bin.lit);
+        if (b > 0)
+          continue;
+        if (b < 0)
+          worker.conflict = bin.clause; // but continue
+        else
+          worker.assign (bin.lit, bin.clause, lit);
+      }
+    } else if (worker.propagated != worker.trail.size ()) {
+      const int lit = worker.trail[worker.propagated++];
+      const unsigned l = Snapshot::vlit (-lit);
+      const size_t end = snapshot.occs_start[l + 1];
+      for (size_t i = snapshot.occs_start[l]; i < end; i++) {
+        const int c = snapshot.occs[i];
+        const unsigned false_literals = ++worker.count[c];
+        if (worker.conflict >= 0)
+          continue; // but still count
+        const unsigned size = snapshot.size (c);
+        if (false_literals + 1 < size)
+          continue;
+        if (false_literals == size) {
+          worker.conflict = c;
+          continue;
+        }
+        const int *lits = snapshot.literals.data () + snapshot.start[c];
+        const int *const end_of_lits = lits + size;
+        const int *k = lits;
+        while (k != end_of_lits && worker.val (*k) < 0)
+          k++;
+        if (k == end_of_lits || worker.val (*k))
+          continue; // conflict found later or satisfied
+        int dom = 0, non_root_level_literals = 0;
+        for (const int *p = lits; p != end_of_lits; p++) {
+          if (p == k || !worker.levels[abs (*p)])
+            continue;
+          const int other = -*p;
+          dom = dom ? worker.dominator (dom, other) : other;
+          non_root_level_literals++;
+        }
+        assert (dom);
+        if (non_root_level_literals > 1 && opts.probehbr)
+          probe_parallel_hyper (worker, c, dom, *k, res);
+        worker.assign (*k, c, dom);
+      }
+    } else
+      break;
+  }
+  return worker.conflict < 0;
+}
+
+void Internal::probe_parallel_literal (ProbeWorker &worker, int probe,
+                                       ProbeResult &res) {
+  res.uip = 0;
+  res.chain.clear ();
+  res.antecedents.clear ();
+  res.hypers.clear ();
+  worker.assume (probe);
+  if (!probe_parallel_propagate (worker, res)) {
+    const Snapshot &snapshot = *worker.snapshot;
+    const int conflict = worker.conflict;
+    const int *lits = snapshot.literals.data () + snapshot.start[conflict];
+    const int *const end = lits + snapshot.size (conflict);
+    int uip = 0;
+    for (const int *k = lits; k != end; k++) {
+      const int other = -*k;
+      if (!worker.levels[abs (other)])
+        continue;
+      uip = uip ? worker.dominator (uip, other) : other;
+    }
+    assert (uip);
+    res.uip = uip;
+    probe_parallel_justify (worker, uip, conflict, res.chain,
+                            res.antecedents);
+    worker.clear_analyzed ();
+    worker.conflict = -1;
+  }
+  res.propagations = worker.propagated2;
+  worker.backtrack (0);
+}
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::probe_parallel_stale (const vector<Clause *> &antecedents) {
+  for (const auto &c : antecedents)
+    if (c->garbage)
+      return true;
+  return false;
+}
+
+// The 'fixed' argument is the number of units when the shard was started,
+// which are exactly the ones assigned by the workers.
+
+void Internal::probe_parallel_commit (int probe, ProbeResult &res,
+                                      int64_t fixed) {
+  assert (!level);
+  stats.probed++;
+  stats.probepar++;
+  stats.propagations.probe += res.propagations;
+
+  for (auto &hyper : res.hypers) {
+    if (val (hyper.dom) || val (hyper.lit))
+      continue;
+    if (probe_parallel_stale (hyper.antecedents)) {
+      stats.probestale++;
+      continue;
+    }
+    bool duplicated = false;
+    for (const auto &w : watches (-hyper.dom))
+      if (w.binary () && w.blit == hyper.lit) {
+        duplicated = true;
+        break;
+      }
+    if (duplicated)
+      continue;
+    Clause *reason = hyper.reason;
+    stats.hbrs++;
+    stats.hbrsizes += reason->size;
+    const bool red = !hyper.contained || reason->redundant;
+    if (red)
+      stats.hbreds++;
+    LOG ("new %s hyper binary resolvent %d %d",
+         (red ? "redundant" : "irredundant"), -hyper.dom, hyper.lit);
+    assert (clause.empty ());
+    assert (lrat_chain.empty ());
+    clause.push_back (-hyper.dom);
+    clause.push_back (hyper.lit);
+    swap (lrat_chain, hyper.chain);
+    (void) new_hyper_binary_resolved_clause (red, 2);
+    clause.clear ();
+    lrat_chain.clear ();
+    if (hyper.contained) {
+      stats.hbrsubs++;
+      LOG (reason, "subsumed original");
+      mark_garbage (reason);
+    }
+  }
+
+  // Even if the result is dropped the probe is only tried again after new
+  // units were found, since the snapshot does not change during the round.
+  //
+  if (!val (probe))
+    propfixed (probe) = fixed;
+
+  const int uip = res.uip;
+  if (!uip)
+    return;
+
+  const signed char tmp = val (uip);
+  if (tmp < 0)
+    return;
+  if (tmp > 0 || probe_parallel_stale (res.antecedents)) {
+    stats.probestale++;
+    return;
+  }
+
+  LOG ("found probing UIP %d of failed literal probe %d", uip, probe);
+  stats.failed++;
+  stats.probefailed++;
+  assert (lrat_chain.empty ());
+  swap (lrat_chain, res.chain);
+  probe_assign_unit (-uip);
+  lrat_chain.clear ();
+  if (!probe_propagate ())
+    learn_empty_clause ();
+}
+
+void Internal::probe_parallel (int64_t limit) {
+
+  assert (!level);
+
+  const size_t shard = opts.probeshard;
+  const unsigned threads = opts.threads;
+
+  Snapshot snapshot;
+  vector<ProbeWorker> workers;
+  vector<int> batch;
+  vector<ProbeResult> results;
+
+  while (!unsat && !terminated_asynchronously () &&
+         !inprocessing_suspended () && stats.propagations.probe < limit) {
+
+    // Do not regenerate probes while filling a shard, since then probes
+    // of the shard would be scheduled again.
+    //
+    batch.clear ();
+    int probe;
+    while (batch.size () < shard &&
+           (batch.empty () || !probes.empty ()) && (probe = next_probe ()))
+      batch.push_back (probe);
+    if (batch.empty ())
+      break;
+    results.resize (batch.size ());
+
+    // Only take the snapshot if there is something to probe.
+    //
+    if (workers.empty ()) {
+      init_snapshot (snapshot, false);
+      PHASE ("probe-round", stats.probingrounds,
+             "snapshot of %zd clauses with %zd literals",
+             snapshot.clauses.size (), snapshot.literals.size ());
+      workers.resize (threads, ProbeWorker (&snapshot, trail.size ()));
+    }
+
+    LOG ("probing %zd literals in parallel", batch.size ());
+    const int64_t fixed = stats.all.fixed;
+
+    parallel_jobs (threads, batch.size (), [&] (unsigned w, size_t i) {
+      ProbeWorker &worker = workers[w];
+      if (worker.vals.empty ())
+        worker.init ();
+      probe_parallel_sync (worker);
+      probe_parallel_literal (worker, batch[i], results[i]);
+    });
+
+    for (size_t i = 0; !unsat && i < batch.size (); i++)
+      probe_parallel_commit (batch[i], results[i], fixed);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 bool Internal::probe_round () {
 
   if (unsat)
     return false;
   if (terminated_asynchronously ())
     return false;
+  if (inprocessing_suspended ())
+    return false;
 
   START_SIMPLIFIER (probe, PROBE);
   stats.probingrounds++;
@@ -815,17 +1179,21 @@ bool Internal::probe_round () {
 
   int probe;
   init_probehbr_lrat ();
-  while (!unsat && !terminated_asynchronously () &&
-         stats.propagations.probe < limit && (probe = next_probe ())) {
-    stats.probed++;
-    LOG ("probing %d", probe);
-    probe_assign_decision (probe);
-    if (probe_propagate ())
-      backtrack ();
-    else
-      failed_literal (probe);
-    clean_probehbr_lrat ();
-  }
+  if (opts.threads > 1)
+    probe_parallel (limit);
+  else
+    while (!unsat && !terminated_asynchronously () &&
+           !inprocessing_suspended () && stats.propagations.probe < limit &&
+           (probe = next_probe ())) {
+      stats.probed++;
+      LOG ("probing %d", probe);
+      probe_assign_decision (probe);
+      if (probe_propagate ())
+        backtrack ();
+      else
+        failed_literal (probe);
+      clean_probehbr_lrat ();
+    }
 
   if (unsat)
     LOG ("probing derived empty clause");
@@ -896,6 +1264,7 @@ void CaDiCaL::Internal::probe (bool update_limits) {
       break;
 
   decompose (); // ... and (ELS) afterwards.
+  reset_binary_graph ();
 
   last.probe.propagations = stats.propagations.search;
 
@@ -906,6 +1275,8 @@ void CaDiCaL::Internal::probe (bool update_limits) {
 
   if (!update_limits)
     return;
+  if (lim.latency.suspended)
+    return; // Resume in next 'solve' call.
 
   const int after = active ();
   const int removed = before - after;
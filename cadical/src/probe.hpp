@@ -0,0 +1,81 @@
+#ifndef _probe_hpp_INCLUDED
+#define _probe_hpp_INCLUDED
+
+#include "snapshot.hpp" // Alphabetically after 'probe.hpp'.
+
+namespace CaDiCaL {
+
+struct Clause;
+
+// With more than one thread probes are propagated in parallel on a
+// read-only snapshot of the clauses (see 'probe_parallel' in 'probe.cpp').
+// In addition to the propagation state of a 'SnapshotWorker' probing keeps
+// the trail position and the parent in the binary implication tree on
+// decision level one of each assigned variable.  Root-level units derived
+// after taking the snapshot are assigned by 'probe_parallel_sync' without
+// putting them on the trail of the worker.
+
+struct ProbeWorker : SnapshotWorker {
+  vector<int> positions; // per variable trail position
+  vector<int> parents;   // per variable parent literal or '0'
+  size_t synced;         // root-level units on 'Internal::trail' assigned
+
+  ProbeWorker (const Snapshot *s, size_t fixed)
+      : SnapshotWorker (s), synced (fixed) {}
+
+  void init () {
+    SnapshotWorker::init ();
+    const size_t vars = vals.size () / 2;
+    positions.resize (vars, 0);
+    parents.resize (vars, 0);
+  }
+  void assign (int lit, int reason, int parent) {
+    const int idx = abs (lit);
+    positions[idx] = (int) trail.size ();
+    parents[idx] = parent;
+    SnapshotWorker::assign (lit, reason);
+  }
+  void assume (int lit) {
+    level++;
+    control.push_back (trail.size ());
+    assign (lit, -1, 0);
+  }
+
+  // Same as 'probe_dominator' in 'probe.cpp'.
+
+  int dominator (int a, int b) const {
+    int l = a, k = b;
+    while (l != k) {
+      if (positions[abs (l)] > positions[abs (k)])
+        std::swap (l, k);
+      if (!parents[abs (l)])
+        return l;
+      k = parents[abs (k)];
+    }
+    return l;
+  }
+};
+
+// Hyper binary resolvent '-dom lit' of a large 'reason' found by a worker.
+
+struct ProbeHyper {
+  int dom, lit;
+  Clause *reason;
+  bool contained;                // resolvent subsumes 'reason'
+  vector<uint64_t> chain;        // LRAT chain (if 'lrat' is set)
+  vector<Clause *> antecedents;  // clauses used to derive it
+};
+
+// Result of propagating a probe in parallel, committed sequentially.
+
+struct ProbeResult {
+  int uip;                       // negation is a failed literal unit
+  int64_t propagations;
+  vector<uint64_t> chain;        // LRAT chain of the unit
+  vector<Clause *> antecedents;  // clauses used to derive it
+  vector<ProbeHyper> hypers;     // hyper binary resolvents
+};
+
+} // namespace CaDiCaL
+
+#endif
@@ -44,6 +44,7 @@ struct Internal;
   PROFILE (bump, 4) \
   PROFILE (checking, 2) \
   PROFILE (cdcl, 1) \
+  PROFILE (clone, 2) \
   PROFILE (collect, 3) \
   PROFILE (compact, 3) \
   PROFILE (condition, 2) \
@@ -64,6 +65,7 @@ struct Internal;
   PROFILE (probe, 2) \
   PROFILE (deduplicate, 3) \
   PROFILE (propagate, 4) \
+  PROFILE (rebuildoccs, 3) \
   PROFILE (reduce, 3) \
   PROFILE (restart, 3) \
   PROFILE (restore, 2) \
@@ -76,6 +78,7 @@ struct Internal;
   PROFILE (ternary, 2) \
   PROFILE (transred, 3) \
   PROFILE (unstable, 2) \
+  PROFILE (updateoccs, 3) \
   PROFILE (vivify, 2) \
   PROFILE (walk, 2)
 
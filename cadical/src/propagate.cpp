@@ -237,6 +237,10 @@ bool Internal::propagate () {
   //
   int64_t before = propagated;
 
+  // Vectorized replacement search if enabled and supported (see 'simd.hpp').
+  //
+  const non_false_literal_search search = opts.simd ? simd_search : 0;
+
   while (!conflict && propagated != trail.size ()) {
 
     const int lit = -trail[propagated++];
@@ -298,6 +302,17 @@ bool Internal::propagate () {
         if (conflict)
           break; // Stop if there was a binary conflict already.
 
+        // For ternary clauses with inlined third literal we can check
+        // whether the clause is satisfied without accessing the clause.
+
+        if (w.ternary ()) {
+          const int third = w.third ();
+          if (val (third) > 0) {
+            j[-1].update_blit (third);
+            continue;
+          }
+        }
+
         // The cache line with the clause data is forced to be loaded here
         // and thus this first memory access below is the real hot-spot of
         // the solver.  Note, that this check is positive very rarely and
@@ -323,7 +338,7 @@ bool Internal::propagate () {
         const signed char u = val (other); // value of the other watch
 
         if (u > 0)
-          j[-1].blit = other; // satisfied, just replace blit
+          j[-1].update_blit (other); // satisfied, just replace blit
         else {
 
           // This follows Ian Gent's (JAIR'13) idea of saving the position
@@ -344,15 +359,25 @@ bool Internal::propagate () {
           int r = 0;
           signed char v = -1;
 
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
+          if (search && end - k >= simd_search_min_literals) {
+            k = search (vals, k, end);
+            if (k != end)
+              v = val (r = *k);
+          } else
+            while (k != end && (v = val (r = *k)) < 0)
+              k++;
 
           if (v < 0) { // need second search starting at the head?
 
             k = lits + 2;
             assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
+            if (search && middle - k >= simd_search_min_literals) {
+              k = search (vals, k, middle);
+              if (k != middle)
+                v = val (r = *k);
+            } else
+              while (k != middle && (v = val (r = *k)) < 0)
+                k++;
           }
 
           w.clause->pos = k - lits; // always save position
@@ -363,7 +388,7 @@ bool Internal::propagate () {
 
             // Replacement satisfied, so just replace 'blit'.
 
-            j[-1].blit = r;
+            j[-1].update_blit (r);
 
           } else if (!v) {
 
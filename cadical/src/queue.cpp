@@ -85,4 +85,25 @@ void Internal::shuffle_queue () {
   queue.unassigned = queue.last;
 }
 
+// Reorder the VMTF queue by the given positions, for instance after
+// loading a snapshot.  As in 'shuffle_queue' the enqueue time stamps are
+// reassigned.  Variables with the same position keep their order.
+
+void Internal::reorder_queue (const vector<uint64_t> &position) {
+  LOG ("reordering queue");
+  vector<int> order;
+  for (int idx = queue.first; idx; idx = links[idx].next)
+    order.push_back (idx);
+  stable_sort (order.begin (), order.end (), [&position] (int a, int b) {
+    return position[a] < position[b];
+  });
+  queue.first = queue.last = 0;
+  for (const int idx : order)
+    queue.enqueue (links, idx);
+  int64_t bumped = queue.bumped;
+  for (int idx = queue.last; idx; idx = links[idx].prev)
+    btab[idx] = bumped--;
+  queue.unassigned = queue.last;
+}
+
 } // namespace CaDiCaL
@@ -14,7 +14,7 @@ struct Link {
   // initialized explicitly in 'init_queue'
 };
 
-typedef std::vector<Link> Links;
+typedef std::vector<Link, PageAllocator<Link>> Links;
 
 // Variable move to front (VMTF) decision queue ordered by 'bumped'.  See
 // our SAT'15 paper for an explanation on how this works.
@@ -85,37 +85,23 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
 
   // We use a separate stack for sorting candidates for removal.  This uses
   // (slightly) more memory but has the advantage to keep the relative order
-  // in 'clauses' intact, which actually due to using stable sorting goes
-  // into the candidate selection (more recently learned clauses are kept if
-  // they otherwise have the same glue and size).
+  // on the 'local' tier stack intact, which actually due to using stable
+  // sorting goes into the candidate selection (more recently learned
+  // clauses are kept if they otherwise have the same glue and size).
+  //
+  // Tier one clauses are always kept and thus not traversed at all (see
+  // 'tier.hpp' and 'tier.cpp').  Only tier two and local clauses are aged.
 
   vector<Clause *> stack;
 
-  stack.reserve (stats.current.redundant);
+  stack.reserve (tiers.local.size ());
 
-  for (const auto &c : clauses) {
-    if (!c->redundant)
-      continue; // Keep irredundant.
-    if (c->garbage)
-      continue; // Skip already marked.
-    if (c->reason)
-      continue; // Need to keep reasons.
-    const unsigned used = c->used;
-    if (used)
-      c->used--;
-    if (c->hyper) {          // Hyper binary and ternary resolvents
-      assert (c->size <= 3); // are only kept for one reduce round
-      if (!used)
-        mark_garbage (c); // (even if 'c->keep' is true) unless
-      continue;           //  used recently.
-    }
-    if (used)
-      continue; // Do keep recently used clauses.
-    if (c->keep)
-      continue; // Forced to keep (see above).
+  collect_local_clauses (stack);
+  demote_tier2_clauses (stack);
 
-    stack.push_back (c);
-  }
+  PHASE ("reduce", stats.reductions,
+         "tiers with %zd core %zd tier2 and %zd local clauses",
+         tiers.core.size (), tiers.tier2.size (), tiers.local.size ());
 
   stable_sort (stack.begin (), stack.end (), reduce_less_useful ());
 
@@ -48,4 +48,18 @@ void Internal::shuffle_scores () {
   }
 }
 
+// Scores changed without the heap knowing about it, e.g., after loading a
+// snapshot, thus the heap has to be rebuilt.
+
+void Internal::rebuild_scores () {
+  LOG ("rebuilding scores");
+  vector<int> tmp;
+  while (!scores.empty ()) {
+    tmp.push_back (scores.front ());
+    (void) scores.pop_front ();
+  }
+  for (const auto &idx : tmp)
+    scores.push_back (idx);
+}
+
 } // namespace CaDiCaL
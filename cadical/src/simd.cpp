@@ -0,0 +1,64 @@
+#include "internal.hpp"
+
+#if !defined(NSIMD) && defined(__x86_64__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+#ifdef SIMD_AVX2
+/*------------------------------------------------------------------------*/
+
+// Each 32-bit lane of the gathered vector starts with the byte holding the
+// value of the corresponding literal.  Shifting that byte into the most
+// significant position makes the sign bit of the lane the sign bit of the
+// value and 'movemask' collects those sign bits of all eight lanes.  A
+// cleared bit in the resulting mask is a literal which is not false.
+
+// Since the search starts at the last replacement position ('pos'), the
+// first few literals are very often not false already.  Gathering eight
+// values for those cases is slower than checking them one by one, which is
+// why the first 'simd_scalar_prefix' literals are checked in scalar code.
+
+__attribute__ ((target ("avx2"))) static int *
+avx2_non_false_literal_search (const signed char *vals, int *begin,
+                               const int *end) {
+  int *k = begin;
+  for (const int *prefix = k + simd_scalar_prefix; k != prefix; k++)
+    if (vals[*k] >= 0)
+      return k;
+  while (end - k >= 8) {
+    const __m256i lits = _mm256_loadu_si256 ((const __m256i *) k);
+    const __m256i words = _mm256_i32gather_epi32 ((const int *) vals, lits, 1);
+    const __m256i bytes = _mm256_slli_epi32 (words, 24);
+    const int falsified = _mm256_movemask_ps (_mm256_castsi256_ps (bytes));
+    if (falsified != 0xff)
+      return k + __builtin_ctz (~falsified);
+    k += 8;
+  }
+  while (k != end && vals[*k] < 0)
+    k++;
+  return k;
+}
+
+non_false_literal_search simd_non_false_literal_search () {
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx2"))
+    return avx2_non_false_literal_search;
+  return 0;
+}
+
+/*------------------------------------------------------------------------*/
+#else
+/*------------------------------------------------------------------------*/
+
+non_false_literal_search simd_non_false_literal_search () { return 0; }
+
+/*------------------------------------------------------------------------*/
+#endif
+/*------------------------------------------------------------------------*/
+
+} // namespace CaDiCaL
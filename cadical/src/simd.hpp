@@ -0,0 +1,47 @@
+#ifndef _simd_hpp_INCLUDED
+#define _simd_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+// Vectorized search for a replacement watch in long clauses during
+// propagation.  The scalar search in 'propagate' is
+//
+//   while (k != end && val (*k) < 0)
+//     k++;
+//
+// and the vectorized version loads eight literals at once and gathers
+// their values from 'vals' with one AVX2 instruction.  Since 'vals' is a
+// byte array but gathering works on 32-bit words, each lane reads four
+// bytes starting at the value of the literal and only the least
+// significant byte is used.  Therefore 'enlarge_vals' pads 'vals' with
+// 'simd_vals_padding' bytes, such that gathering the value of 'max_var'
+// does not read beyond allocated memory.
+
+// SSE4 does not have gather instructions and simulating them with scalar
+// loads does not give any benefit over the scalar search.  Thus the only
+// vectorized implementation is for AVX2, which is selected at run-time if
+// the processor supports it.  On other architectures or compilers (or if
+// 'NSIMD' is defined) the scalar search is used.
+
+typedef int *(*non_false_literal_search) (const signed char *vals,
+                                          int *begin, const int *end);
+
+// Returns a search function supported on this machine or zero otherwise.
+//
+non_false_literal_search simd_non_false_literal_search ();
+
+// Vectorized search is only invoked on at least that many literals.
+//
+static const int simd_search_min_literals = 8;
+
+// Number of literals checked first one by one in the vectorized search.
+//
+static const int simd_scalar_prefix = 4;
+
+// Additional bytes allocated after 'vals' (see above).
+//
+static const unsigned simd_vals_padding = 3;
+
+} // namespace CaDiCaL
+
+#endif
@@ -0,0 +1,86 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+Slab::Slab (Internal *i)
+    : internal (i), page (0), top (0), end (0), live (0) {}
+
+Slab::~Slab () {
+  for (const auto &p : pages)
+    deallocate_pages (&internal->pages, p, page_bytes);
+}
+
+void Slab::release (char *p, size_t bytes) {
+  assert (!(bytes & 7));
+  if (bytes < min_bytes) {
+    internal->stats.slab.wasted += bytes;
+    return;
+  }
+  const size_t size_class = bytes >> 3;
+  if (free.size () <= size_class)
+    free.resize (size_class + 1, 0);
+  *(char **) p = free[size_class];
+  free[size_class] = p;
+}
+
+char *Slab::allocate (size_t bytes) {
+  assert (!(bytes & 7));
+  if (bytes > max_bytes)
+    return 0;
+  auto &stats = internal->stats.slab;
+  stats.allocated++;
+  stats.live += bytes;
+  live++;
+  const size_t size_class = bytes >> 3;
+  if (size_class < free.size ()) {
+    char *res = free[size_class];
+    if (res) {
+      free[size_class] = *(char **) res;
+      stats.reused++;
+      return res;
+    }
+  }
+  if ((size_t) (end - top) < bytes) {
+    if (top)
+      release (top, end - top);
+    if (++page >= pages.size ()) {
+      pages.push_back ((char *) allocate_pages (&internal->pages, page_bytes));
+      page = pages.size () - 1;
+      stats.bytes += page_bytes;
+      LOG ("allocated slab page %zu", page);
+    }
+    top = pages[page];
+    end = top + page_bytes;
+  }
+  char *res = top;
+  top += bytes;
+  return res;
+}
+
+void Slab::deallocate (char *p, size_t bytes) {
+  assert (live);
+  live--;
+  internal->stats.slab.live -= bytes;
+  release (p, bytes);
+}
+
+void Slab::shrink (char *p, size_t old_bytes, size_t new_bytes) {
+  assert (new_bytes < old_bytes);
+  internal->stats.slab.live -= old_bytes - new_bytes;
+  release (p + new_bytes, old_bytes - new_bytes);
+}
+
+void Slab::recycle () {
+  assert (!live);
+  if (pages.empty ())
+    return;
+  LOG ("recycling %zu slab pages", pages.size ());
+  internal->stats.slab.recycled++;
+  internal->stats.slab.wasted = 0;
+  fill (free.begin (), free.end (), (char *) 0);
+  page = 0;
+  top = pages[0];
+  end = top + page_bytes;
+}
+
+} // namespace CaDiCaL
@@ -0,0 +1,68 @@
+#ifndef _slab_hpp_INCLUDED
+#define _slab_hpp_INCLUDED
+
+#include <vector>
+
+namespace CaDiCaL {
+
+// Clauses are allocated in CaDiCaL outside of the arena and only moved to
+// the arena during garbage collection (see 'arena.hpp').  With high
+// conflict rates allocating and deleting every learned clause with 'new'
+// and 'delete' becomes costly.  Therefore clauses are allocated from this
+// slab allocator instead, unless they are very large.  It uses large pages
+// and allocates consecutively (bump pointer) from the current page.  The
+// memory of deleted clauses is kept on a free list for its size class
+// (clause sizes are multiples of 8 bytes) and reused for clauses of the
+// same size.  If a clause is shrunken the removed tail is put on the free
+// list of its size class too.  Remaining tails of pages and tails which are
+// too small to hold a clause are wasted until the moving garbage collector
+// 'copy_non_garbage_clauses' has moved all clauses to the arena and thus
+// all clauses in the slab are deleted.  Then the slab is recycled, i.e.,
+// the free lists are reset and allocation starts again at the first page.
+
+// Since the memory used by a clause on the slab is determined by its
+// current size, deallocation only needs to know whether the clause is on
+// the slab, which is stored in the 'slab' flag of the clause.
+
+struct Internal;
+
+class Slab {
+
+  Internal *internal;
+
+  std::vector<char *> pages; // All allocated pages.
+  size_t page;               // Index of current page in 'pages'.
+  char *top, *end;           // Free memory in current page.
+
+  std::vector<char *> free; // Free lists indexed by size class.
+  size_t live;              // Number of allocated clauses.
+
+  void release (char *, size_t bytes); // Put on free list (if possible).
+
+public:
+  // Pages are huge pages (see 'pages.hpp') and clauses larger than
+  // 'max_bytes' are not allocated on the slab.
+  //
+  static const size_t page_bytes = (size_t) 1 << 21;
+  static const size_t min_bytes = 32;
+  static const size_t max_bytes = 1024;
+
+  Slab (Internal *);
+  ~Slab ();
+
+  // Returns zero if the clause is too large.
+  //
+  char *allocate (size_t bytes);
+
+  void deallocate (char *, size_t bytes);
+  void shrink (char *, size_t old_bytes, size_t new_bytes);
+
+  // Can only be called if all clauses allocated on the slab are deleted.
+  //
+  bool empty () const { return !live; }
+  void recycle ();
+};
+
+} // namespace CaDiCaL
+
+#endif
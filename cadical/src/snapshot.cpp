@@ -0,0 +1,190 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+int Snapshot::find (Clause *c, int lit) const {
+  const unsigned l = vlit (lit);
+  for (size_t i = occs_start[l]; i < occs_start[l + 1]; i++)
+    if (clauses[occs[i]] == c)
+      return occs[i];
+  for (size_t i = bins_start[l]; i < bins_start[l + 1]; i++)
+    if (clauses[bins[i].clause] == c)
+      return bins[i].clause;
+  return -1;
+}
+
+void SnapshotWorker::init () {
+  vals = snapshot->vals;
+  const size_t vars = vals.size () / 2;
+  levels.resize (vars, 0);
+  reasons.resize (vars, -1);
+  seen.resize (vars, 0);
+  count.resize (snapshot->clauses.size (), 0);
+  propagated = propagated2 = 0;
+  level = 0;
+  conflict = ignore = -1;
+  propagations = 0;
+}
+
+// Same order as 'vivify_propagate' in 'vivify.cpp', i.e., binary clauses
+// first, but counting false literals of large clauses instead of watching
+// them.  The counts of all clauses (including
+// the ignored one) are updated for all propagated literals, which is
+// required to undo them during backtracking.
+
+bool SnapshotWorker::propagate () {
+  assert (conflict < 0);
+  const size_t before = propagated2;
+  for (;;) {
+    if (propagated2 != trail.size ()) {
+      const unsigned l = Snapshot::vlit (-trail[propagated2++]);
+      const auto &bins = snapshot->bins;
+      const size_t end = snapshot->bins_start[l + 1];
+      for (size_t i = snapshot->bins_start[l]; i < end; i++) {
+        const SnapshotBinary &bin = bins[i];
+        if (bin.clause == ignore)
+          continue;
+        const signed char b = val (bin.lit);
+        if (b > 0)
+          continue;
+        if (b < 0)
+          conflict = bin.clause; // but continue
+        else
+          assign (bin.lit, bin.clause);
+      }
+    } else if (conflict < 0 && propagated != trail.size ()) {
+      const unsigned l = Snapshot::vlit (-trail[propagated++]);
+      const auto &occs = snapshot->occs;
+      const size_t end = snapshot->occs_start[l + 1];
+      for (size_t i = snapshot->occs_start[l]; i < end; i++) {
+        const int c = occs[i];
+        const unsigned false_literals = ++count[c];
+        if (conflict >= 0 || c == ignore)
+          continue;
+        const unsigned size = snapshot->size (c);
+        if (false_literals + 1 < size)
+          continue;
+        const int *lits = snapshot->literals.data () + snapshot->start[c];
+        if (false_literals == size) {
+          conflict = c;
+          continue;
+        }
+        const int *const end_of_lits = lits + size;
+        const int *k = lits;
+        while (k != end_of_lits && val (*k) < 0)
+          k++;
+        if (k != end_of_lits && !val (*k))
+          assign (*k, c);
+      }
+    } else
+      break;
+  }
+  propagations += propagated2 - before;
+  return conflict < 0;
+}
+
+void SnapshotWorker::backtrack (int new_level) {
+  assert (new_level <= level);
+  if (new_level == level)
+    return;
+  const size_t assigned = control[new_level];
+  const auto &occs = snapshot->occs;
+  for (size_t i = trail.size (); i > assigned; i--) {
+    const int lit = trail[i - 1];
+    if (i <= propagated) {
+      const unsigned l = Snapshot::vlit (-lit);
+      const size_t end = snapshot->occs_start[l + 1];
+      for (size_t j = snapshot->occs_start[l]; j < end; j++)
+        count[occs[j]]--;
+    }
+    vals[Snapshot::vlit (lit)] = 0;
+    vals[Snapshot::vlit (-lit)] = 0;
+  }
+  trail.resize (assigned);
+  control.resize (new_level);
+  if (propagated > assigned)
+    propagated = assigned;
+  if (propagated2 > assigned)
+    propagated2 = assigned;
+  level = new_level;
+}
+
+void SnapshotWorker::clear_analyzed () {
+  for (const auto &idx : analyzed)
+    seen[idx] = 0;
+  analyzed.clear ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Take a snapshot of all non-garbage clauses (only of the redundant clauses
+// likely to be kept if 'only_kept' is set) in compressed sparse row format.
+// Satisfied clauses and false literals are skipped.
+
+void Internal::init_snapshot (Snapshot &snapshot, bool only_kept) {
+  const size_t size = 2 * (max_var + 1);
+  snapshot.vals.resize (size, 0);
+  for (auto idx : vars) {
+    const signed char tmp = val (idx);
+    snapshot.vals[Snapshot::vlit (idx)] = tmp;
+    snapshot.vals[Snapshot::vlit (-idx)] = -tmp;
+  }
+  snapshot.occs_start.resize (size + 1, 0);
+  snapshot.bins_start.resize (size + 1, 0);
+  snapshot.start.push_back (0);
+  for (const auto &c : clauses) {
+    if (c->garbage || (only_kept && !likely_to_be_kept_clause (c)))
+      continue;
+    const size_t start = snapshot.literals.size ();
+    bool satisfied = false;
+    for (const auto &lit : *c) {
+      const signed char tmp = val (lit);
+      if (tmp > 0) {
+        satisfied = true;
+        break;
+      }
+      if (!tmp)
+        snapshot.literals.push_back (lit);
+    }
+    const size_t new_size = snapshot.literals.size () - start;
+    if (satisfied || new_size < 2) {
+      snapshot.literals.resize (start);
+      continue;
+    }
+    snapshot.clauses.push_back (c);
+    snapshot.start.push_back (snapshot.literals.size ());
+    auto &counts =
+        new_size == 2 ? snapshot.bins_start : snapshot.occs_start;
+    for (size_t i = start; i < snapshot.literals.size (); i++)
+      counts[Snapshot::vlit (snapshot.literals[i])]++;
+  }
+  size_t occs = 0, bins = 0;
+  for (size_t l = 0; l <= size; l++) {
+    occs += snapshot.occs_start[l];
+    snapshot.occs_start[l] = occs;
+    bins += snapshot.bins_start[l];
+    snapshot.bins_start[l] = bins;
+  }
+  snapshot.occs.resize (occs);
+  snapshot.bins.resize (bins);
+  for (int i = (int) snapshot.clauses.size () - 1; i >= 0; i--) {
+    const int *lits = snapshot.literals.data () + snapshot.start[i];
+    if (snapshot.size (i) == 2) {
+      for (int j = 0; j < 2; j++) {
+        const unsigned l = Snapshot::vlit (lits[j]);
+        SnapshotBinary &bin = snapshot.bins[--snapshot.bins_start[l]];
+        bin.lit = lits[!j];
+        bin.clause = i;
+      }
+    } else {
+      for (const int *k = lits; k != lits + snapshot.size (i); k++)
+        snapshot.occs[--snapshot.occs_start[Snapshot::vlit (*k)]] = i;
+    }
+  }
+  LOG ("snapshot of %zd clauses with %zd literals",
+       snapshot.clauses.size (), snapshot.literals.size ());
+}
+
+} // namespace CaDiCaL
@@ -0,0 +1,78 @@
+#ifndef _snapshot_hpp_INCLUDED
+#define _snapshot_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+struct Clause;
+
+// Parallel simplifications (vivification of redundant clauses and failed
+// literal probing) let worker threads propagate on a read-only snapshot of
+// the clauses (see 'init_snapshot' in 'snapshot.cpp').  The snapshot only
+// keeps literals not fixed at the time it was taken.
+
+struct SnapshotBinary {
+  int lit;    // other literal of the binary clause
+  int clause; // its snapshot index
+};
+
+struct Snapshot {
+  vector<Clause *> clauses;     // clause of each snapshot index
+  vector<size_t> start;         // literals of clause 'i' are stored in
+  vector<int> literals;         // 'literals[start[i]]' to 'start[i+1]'
+  vector<size_t> occs_start;    // per literal start in 'occs'
+  vector<int> occs;             // large clauses per literal
+  vector<size_t> bins_start;    // per literal start in 'bins'
+  vector<SnapshotBinary> bins;  // binary clauses per literal
+  vector<signed char> vals;     // root-level assignment per literal
+
+  static unsigned vlit (int lit) { return 2u * abs (lit) + (lit < 0); }
+  int size (int i) const { return start[i + 1] - start[i]; }
+  int find (Clause *, int lit) const; // snapshot index of clause
+};
+
+// Propagation state of a worker thread.  Large clauses are not watched
+// (the snapshot can not be changed) but propagated by counting their false
+// literals in 'count'.
+
+struct SnapshotWorker {
+  const Snapshot *snapshot;
+  vector<signed char> vals; // per literal
+  vector<int> levels;       // per variable
+  vector<int> reasons;      // per variable snapshot index or '-1'
+  vector<signed char> seen; // per variable
+  vector<unsigned> count;   // false literals per snapshot clause
+  vector<int> trail;
+  vector<size_t> control; // trail position of decisions
+  size_t propagated, propagated2;
+  int level, conflict, ignore;
+  int64_t propagations;
+  vector<int> sorted, analyzed, stack;
+
+  SnapshotWorker (const Snapshot *s)
+      : snapshot (s), propagated (0), propagated2 (0), level (0),
+        conflict (-1), ignore (-1), propagations (0) {}
+
+  void init ();
+  signed char val (int lit) const { return vals[Snapshot::vlit (lit)]; }
+  void assign (int lit, int reason) {
+    const int idx = abs (lit);
+    assert (!val (lit));
+    vals[Snapshot::vlit (lit)] = 1;
+    vals[Snapshot::vlit (-lit)] = -1;
+    levels[idx] = level;
+    reasons[idx] = reason;
+    trail.push_back (lit);
+  }
+  void assume (int lit) {
+    level++;
+    control.push_back (trail.size ());
+    assign (lit, -1);
+  }
+  bool propagate ();
+  void backtrack (int new_level);
+  void clear_analyzed ();
+};
+
+} // namespace CaDiCaL
+
+#endif
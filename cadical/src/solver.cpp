@@ -1635,6 +1635,212 @@ void Solver::copy (Solver &other) const {
   external->copy_flags (*other.external);
 }
 
+void Solver::clone (Solver &other) const {
+  REQUIRE_READY_STATE ();
+  REQUIRE (other.state () & CONFIGURING, "target solver already modified");
+  internal->opts.copy (other.internal->opts);
+  other.reserve (external->max_var);
+  ClauseCopier clause_copier (other);
+  if (internal->unsat || other.internal->proof ||
+      other.internal->opts.check)
+    traverse_clauses (clause_copier);
+  else {
+    external->traverse_all_frozen_units_as_clauses (clause_copier);
+    internal->clone_clauses (*other.internal);
+    internal->traverse_constraint (clause_copier);
+  }
+  WitnessCopier witness_copier (other.external);
+  traverse_witnesses_forward (witness_copier);
+  external->copy_flags (*other.external);
+  external->clone_variables (*other.external);
+}
+
+/*------------------------------------------------------------------------*/
+
+class ClauseImageWriter : public ClauseIterator {
+  Image &image;
+
+public:
+  ClauseImageWriter (Image &i) : image (i) {}
+  bool clause (const vector<int> &c) {
+    for (const auto &lit : c)
+      if (!image.put_int (lit))
+        return false;
+    return image.put_int (0);
+  }
+};
+
+class WitnessImageWriter : public WitnessIterator {
+  Image &image;
+
+public:
+  int64_t witnesses;
+  WitnessImageWriter (Image &i) : image (i), witnesses (0) {}
+  bool write (const vector<int> &a) {
+    for (const auto &lit : a)
+      if (!image.put_int (lit))
+        return false;
+    return image.put_int (0);
+  }
+  bool witness (const vector<int> &c, const vector<int> &w, uint64_t id) {
+    witnesses++;
+    return write (w) && image.put (id) && write (c);
+  }
+};
+
+struct WitnessCounter : public WitnessIterator {
+  int64_t witnesses;
+  WitnessCounter () : witnesses (0) {}
+  bool witness (const vector<int> &, const vector<int> &, uint64_t) {
+    witnesses++;
+    return true;
+  }
+};
+
+const char *Solver::save_snapshot (const char *path) {
+  LOG_API_CALL_BEGIN ("save_snapshot", path);
+  REQUIRE_READY_STATE ();
+#ifndef QUIET
+  const double start = internal->time ();
+#endif
+  internal->restore_clauses ();
+  ClauseCounter clause_counter;
+  (void) traverse_clauses (clause_counter);
+  WitnessCounter witness_counter;
+  (void) traverse_witnesses_forward (witness_counter);
+  File *file = File::write (internal, path);
+  const char *res = 0;
+  if (file) {
+    Image image (file);
+    bool ok = file->put (Image::magic) &&
+              image.put ((uint64_t) external->max_var) &&
+              image.put ((uint64_t) number_of_options);
+    for (Option *o = Options::begin (); ok && o != Options::end (); o++)
+      ok = image.put_string (o->name) &&
+           image.put_int (o->val (&internal->opts));
+    ClauseImageWriter clause_writer (image);
+    ok = ok && image.put ((uint64_t) clause_counter.clauses) &&
+         traverse_clauses (clause_writer);
+    WitnessImageWriter witness_writer (image);
+    ok = ok && image.put ((uint64_t) witness_counter.witnesses) &&
+         traverse_witnesses_forward (witness_writer);
+    ok = ok && external->write_image_variables (image);
+    if (!ok)
+      res = internal->error_message.init (
+          "writing to snapshot file '%s' failed", path);
+    delete file;
+  } else
+    res = internal->error_message.init (
+        "failed to open snapshot file '%s' for writing", path);
+#ifndef QUIET
+  if (!res) {
+    const double end = internal->time ();
+    MSG ("wrote snapshot of %" PRId64 " clauses and %" PRId64
+         " witnesses in %.2f seconds %s time",
+         clause_counter.clauses, witness_counter.witnesses, end - start,
+         internal->opts.realtime ? "real" : "process");
+  }
+#endif
+  LOG_API_CALL_RETURNS ("save_snapshot", path, res);
+  return res;
+}
+
+// Reads zero terminated literals of the image and checks them against the
+// number of variables in the header.  Clauses are replayed through the API
+// which otherwise would abort on invalid literals.
+
+static bool get_image_literals (Image &image, int vars, vector<int> &lits) {
+  lits.clear ();
+  int lit;
+  while (image.get_int (lit) && abs (lit) <= vars)
+    if (lit)
+      lits.push_back (lit);
+    else
+      return true;
+  return false;
+}
+
+const char *Solver::load_snapshot (const char *path) {
+  LOG_API_CALL_BEGIN ("load_snapshot", path);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () & CONFIGURING, "solver already modified");
+#ifndef QUIET
+  const double start = internal->time ();
+#endif
+  File *file = File::read (internal, path);
+  const char *res = 0, *err = 0;
+  uint64_t clauses = 0, witnesses = 0;
+  if (file) {
+    Image image (file);
+    uint64_t n = 0;
+    int vars = 0;
+    for (const char *p = Image::magic; !err && *p; p++)
+      if (file->get () != *p)
+        err = "invalid header";
+    if (!err && (!image.get (n) || n > (uint64_t) INT_MAX))
+      err = "invalid maximum variable";
+    vars = n;
+    if (!err && !image.get (n))
+      err = "invalid number of options";
+    string name;
+    while (!err && n--) {
+      int val;
+      if (!image.get_string (name) || !image.get_int (val))
+        err = "invalid option";
+      else if (!internal->opts.set (name.c_str (), val))
+        err = "unknown option";
+    }
+    if (!err) {
+      reserve (vars);
+      if (!image.get (clauses))
+        err = "invalid number of clauses";
+    }
+    vector<int> clause, witness;
+    for (uint64_t i = 0; !err && i < clauses; i++) {
+      if (!get_image_literals (image, vars, clause))
+        err = "invalid clause";
+      else {
+        for (const auto &lit : clause)
+          add (lit);
+        add (0);
+      }
+    }
+    if (!err && !image.get (witnesses))
+      err = "invalid number of witnesses";
+    for (uint64_t i = 0; !err && i < witnesses; i++) {
+      uint64_t id;
+      if (!get_image_literals (image, vars, witness) ||
+          !image.get (id) || !id ||
+          !get_image_literals (image, vars, clause) || clause.empty ())
+        err = "invalid witness";
+      else
+        external->push_external_clause_and_witness_on_extension_stack (
+            clause, witness, id);
+    }
+    if (!err && !external->read_image_variables (image, vars))
+      err = "invalid variables";
+    if (!err && file->get () != EOF)
+      err = "trailing data";
+    if (err)
+      res = internal->error_message.init ("%s in snapshot file '%s'", err,
+                                          path);
+    delete file;
+  } else
+    res = internal->error_message.init (
+        "failed to open snapshot file '%s' for reading", path);
+#ifndef QUIET
+  if (!res) {
+    const double end = internal->time ();
+    MSG ("loaded snapshot of %" PRIu64 " clauses and %" PRIu64
+         " witnesses in %.2f seconds %s time",
+         clauses, witnesses, end - start,
+         internal->opts.realtime ? "real" : "process");
+  }
+#endif
+  LOG_API_CALL_RETURNS ("load_snapshot", path, res);
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 void Solver::section (const char *title) {
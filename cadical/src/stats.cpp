@@ -164,6 +164,10 @@ void Stats::print (Internal *internal) {
          stats.elimres, relative (stats.elimres, stats.all.eliminated));
     PRT ("  elimrestried:  %15" PRId64 "   %10.2f %%  per resolution",
          stats.elimrestried, percent (stats.elimrestried, stats.elimres));
+    PRT ("  elimsets:      %15" PRId64 "   %10.2f    candidates per set",
+         stats.elimsets, relative (stats.elimchecked, stats.elimsets));
+    PRT ("  elimreused:    %15" PRId64 "   %10.2f %%  per checked",
+         stats.elimreused, percent (stats.elimreused, stats.elimchecked));
   }
   if (all || stats.ext_prop.ext_cb) {
     PRT ("ext.prop. calls: %15" PRId64 "   %10.2f %%  of queries",
@@ -214,6 +218,10 @@ void Stats::print (Internal *internal) {
          relative (stats.probingrounds, stats.probingphases));
     PRT ("  probed:        %15" PRId64 "   %10.2f    per failed",
          stats.probed, relative (stats.probed, stats.failed));
+    PRT ("  probepar:      %15" PRId64 "   %10.2f %%  per probed",
+         stats.probepar, percent (stats.probepar, stats.probed));
+    PRT ("  probestale:    %15" PRId64 "   %10.2f %%  per probepar",
+         stats.probestale, percent (stats.probestale, stats.probepar));
     PRT ("  hbrs:          %15" PRId64 "   %10.2f    per probed",
          stats.hbrs, relative (stats.hbrs, stats.probed));
     PRT ("  hbrsizes:      %15" PRId64 "   %10.2f    per hbr",
@@ -255,6 +263,8 @@ void Stats::print (Internal *internal) {
          stats.promoted1, percent (stats.promoted1, stats.learned.clauses));
     PRT ("  promoted2:     %15" PRId64 "   %10.2f %%  per learned",
          stats.promoted2, percent (stats.promoted2, stats.learned.clauses));
+    PRT ("  demoted:       %15" PRId64 "   %10.2f %%  per learned",
+         stats.demoted, percent (stats.demoted, stats.learned.clauses));
     PRT ("  improvedglue:  %15" PRId64 "   %10.2f %%  per learned",
          stats.improvedglue,
          percent (stats.improvedglue, stats.learned.clauses));
@@ -302,6 +312,59 @@ void Stats::print (Internal *internal) {
        stats.minishrunken,
        percent (stats.minishrunken, stats.learned.literals));
 
+  if (all || stats.occs.rebuilt) {
+    const int64_t connections = stats.occs.rebuilt + stats.occs.updated;
+    PRT ("occs:            %15" PRId64 "   %10.2f    per elimination phase",
+         connections, relative (connections, stats.elimphases));
+    PRT ("  rebuilt:       %15" PRId64 "   %10.2f %%  of connections",
+         stats.occs.rebuilt, percent (stats.occs.rebuilt, connections));
+    PRT ("  updated:       %15" PRId64 "   %10.2f %%  of connections",
+         stats.occs.updated, percent (stats.occs.updated, connections));
+    PRT ("  flushed:       %15" PRId64 "   %10.2f    per update",
+         stats.occs.flushed,
+         relative (stats.occs.flushed, stats.occs.updated));
+    PRT ("  connected:     %15" PRId64 "   %10.2f    per update",
+         stats.occs.connected,
+         relative (stats.occs.connected, stats.occs.updated));
+#ifndef QUIET
+    const double rebuilding = internal->profiles.rebuildoccs.value;
+    const double updating = internal->profiles.updateoccs.value;
+    if (rebuilding > 0 || updating > 0) {
+      PRT ("  rebuildtime:   %15.2f   %10.2f ms per rebuild", rebuilding,
+           relative (1e3 * rebuilding, stats.occs.rebuilt));
+      PRT ("  updatetime:    %15.2f   %10.2f ms per update", updating,
+           relative (1e3 * updating, stats.occs.updated));
+    }
+#endif
+  }
+
+  if (all || stats.latency.calls) {
+    PRT ("latency:         %15" PRId64 "   %10.2f %%  suspended per call",
+         stats.latency.calls,
+         percent (stats.latency.suspended, stats.latency.calls));
+    const char *names[2] = {"solve", "inpro"};
+    const int64_t *histograms[2] = {stats.latency.solve,
+                                    stats.latency.inprocessing};
+    for (int h = 0; h < 2; h++) {
+      for (int i = 0; i < Stats::latency_buckets; i++) {
+        const int64_t count = histograms[h][i];
+        if (!count)
+          continue;
+        char label[32];
+        if (i + 1 == Stats::latency_buckets)
+          snprintf (label, sizeof label, "%s>=%.0fs:", names[h],
+                    (1 << (i - 1)) * 1e-3);
+        else if (i > 10)
+          snprintf (label, sizeof label, "%s<%.0fs:", names[h],
+                    (1 << i) * 1e-3);
+        else
+          snprintf (label, sizeof label, "%s<%dms:", names[h], 1 << i);
+        PRT ("  %-14s %15" PRId64 "   %10.2f %%  of calls", label, count,
+             percent (count, stats.latency.calls));
+      }
+    }
+  }
+
   if (all || stats.conflicts) {
     PRT ("otfs:            %15" PRId64 "   %10.2f %%  of conflict",
          stats.otfs.subsumed + stats.otfs.strengthened,
@@ -315,6 +378,23 @@ void Stats::print (Internal *internal) {
          percent (stats.otfs.strengthened, stats.conflicts));
   }
 
+  if (all || stats.pages.peak) {
+    PRT ("pages:           %15" PRId64 "   %10.2f %%  mapped in huge pages",
+         stats.pages.mapped,
+         percent (stats.pages.transparent + stats.pages.hugetlb,
+                  stats.pages.mapped));
+    PRT ("  peak:          %15" PRId64 "   %10.2f MB mapped",
+         stats.pages.peak, stats.pages.peak / (double) (1l << 20));
+    PRT ("  transparent:   %15" PRId64 "   %10.2f %%  of mapped",
+         stats.pages.transparent,
+         percent (stats.pages.transparent, stats.pages.mapped));
+    PRT ("  hugetlb:       %15" PRId64 "   %10.2f %%  of mapped",
+         stats.pages.hugetlb,
+         percent (stats.pages.hugetlb, stats.pages.mapped));
+    PRT ("  numabound:     %15" PRId64 "   %10.2f %%  of mapped",
+         stats.pages.bound, percent (stats.pages.bound, stats.pages.mapped));
+  }
+
   PRT ("propagations:    %15" PRId64 "   %10.2f M  per second",
        propagations, relative (propagations / 1e6, t));
   PRT ("  coverprops:    %15" PRId64 "   %10.2f %%  of propagations",
@@ -391,6 +471,23 @@ void Stats::print (Internal *internal) {
     PRT ("  literals:      %15" PRId64 "   %10.2f    per restored clause",
          stats.restoredlits, relative (stats.restoredlits, stats.restored));
   }
+  if (all || stats.slab.allocated) {
+    PRT ("slab:            %15" PRId64 "   %10.2f    per second",
+         stats.slab.allocated, relative (stats.slab.allocated, t));
+    PRT ("  freelist:      %15" PRId64 "   %10.2f %%  of allocated",
+         stats.slab.reused,
+         percent (stats.slab.reused, stats.slab.allocated));
+    PRT ("  recycled:      %15" PRId64 "   %10.2f    interval",
+         stats.slab.recycled,
+         relative (stats.slab.allocated, stats.slab.recycled));
+    PRT ("  slabbytes:     %15" PRId64 "   %10.2f MB pages",
+         stats.slab.bytes, stats.slab.bytes / (double) (1l << 20));
+    PRT ("  fragmented:    %15" PRId64 "   %10.2f %%  of slab bytes",
+         stats.slab.bytes - stats.slab.live,
+         percent (stats.slab.bytes - stats.slab.live, stats.slab.bytes));
+    PRT ("  wasted:        %15" PRId64 "   %10.2f %%  of slab bytes",
+         stats.slab.wasted, percent (stats.slab.wasted, stats.slab.bytes));
+  }
   if (all || stats.stabphases) {
     PRT ("stabilizing:     %15" PRId64 "   %10.2f %%  of conflicts",
          stats.stabphases, percent (stats.stabconflicts, stats.conflicts));
@@ -408,6 +505,12 @@ void Stats::print (Internal *internal) {
     PRT ("  decompositions:%15" PRId64 "   %10.2f    per phase",
          stats.decompositions,
          relative (stats.decompositions, stats.probingphases));
+    PRT ("  bingraphs:     %15" PRId64 "   %10.2f    per phase",
+         stats.bingraphs, relative (stats.bingraphs, stats.probingphases));
+    PRT ("  bingraphreuse: %15" PRId64 "   %10.2f %%  of requested",
+         stats.bingraphreused,
+         percent (stats.bingraphreused,
+                  stats.bingraphs + stats.bingraphreused));
   }
   if (all || stats.subsumed) {
     PRT ("subsumed:        %15" PRId64 "   %10.2f %%  of all clauses",
@@ -434,6 +537,22 @@ void Stats::print (Internal *internal) {
          stats.subchecks, relative (stats.subchecks, stats.subtried));
     PRT ("  subchecks2:    %15" PRId64 "   %10.2f %%  per subcheck",
          stats.subchecks2, percent (stats.subchecks2, stats.subchecks));
+    PRT ("  subsigs:       %15" PRId64 "   %10.2f    per tried",
+         stats.subsigs, relative (stats.subsigs, stats.subtried));
+    PRT ("  subsigsrej:    %15" PRId64 "   %10.2f %%  per subsig",
+         stats.subsigsrejected,
+         percent (stats.subsigsrejected, stats.subsigs));
+#ifndef QUIET
+    if (internal->profiles.subsume.value > 0)
+      PRT ("  subchecktime:  %15.2f   %10.2f M  checks per second",
+           internal->profiles.subsume.value,
+           relative (1e-6 * stats.subchecks,
+                     internal->profiles.subsume.value));
+#endif
+    PRT ("  subshards:     %15" PRId64 "   %10.2f    per round",
+         stats.subshards, relative (stats.subshards, stats.subsumerounds));
+    PRT ("  subparallel:   %15" PRId64 "   %10.2f %%  per subcheck",
+         stats.subparallel, percent (stats.subparallel, stats.subchecks));
     PRT ("  elimotfsub:    %15" PRId64 "   %10.2f %%  of subsumed",
          stats.elimotfsub, percent (stats.elimotfsub, stats.subsumed));
     PRT ("  elimbwsub:     %15" PRId64 "   %10.2f %%  of subsumed",
@@ -508,6 +627,10 @@ void Stats::print (Internal *internal) {
     PRT ("  vivifystred3:  %15" PRId64 "   %10.2f %%  per vivifystrs",
          stats.vivifystred3,
          percent (stats.vivifystred3, stats.vivifystrs));
+    PRT ("  vivifypar:     %15" PRId64 "   %10.2f %%  per vivify check",
+         stats.vivifypar, percent (stats.vivifypar, stats.vivifychecks));
+    PRT ("  vivifystale:   %15" PRId64 "   %10.2f %%  per vivifypar",
+         stats.vivifystale, percent (stats.vivifystale, stats.vivifypar));
     PRT ("  vivifydecs:    %15" PRId64 "   %10.2f    per checks",
          stats.vivifydecs, relative (stats.vivifydecs, stats.vivifychecks));
     PRT ("  vivifyreused:  %15" PRId64 "   %10.2f %%  per decision",
@@ -132,6 +132,7 @@ struct Stats {
   int64_t improvedglue;   // improved glue during bumping
   int64_t promoted1;      // promoted clauses to tier one
   int64_t promoted2;      // promoted clauses to tier two
+  int64_t demoted;        // demoted clauses from tier two
   int64_t bumped;         // seen and bumped variables in 'analyze'
   int64_t recomputed;     // recomputed glues 'recompute_glue'
   int64_t searched;       // searched decisions in 'decide'
@@ -157,6 +158,10 @@ struct Stats {
   int64_t subtried;  // number of tried subsumptions
   int64_t subchecks; // number of pair-wise subsumption checks
   int64_t subchecks2;    // same but restricted to binary clauses
+  int64_t subsigs;         // number of clause signature checks
+  int64_t subsigsrejected; // pairs rejected by clause signatures
+  int64_t subshards;     // number of shards checked in parallel
+  int64_t subparallel;   // number of subsumption checks in parallel
   int64_t elimotfsub;    // number of on-the-fly subsumed during elimination
   int64_t subsumerounds; // number of subsumption rounds
   int64_t subsumephases; // number of scheduled subsumption phases
@@ -176,12 +181,17 @@ struct Stats {
   int64_t elimxors;       // number of XOR gates found during elimination
   int64_t elimbwsub;      // number of eager backward subsumed clauses
   int64_t elimbwstr;      // number of eager backward strengthened clauses
+  int64_t elimsets;       // number of independent candidate sets
+  int64_t elimchecked;    // number of candidates checked in parallel
+  int64_t elimreused;     // number of parallel checks used in elimination
   int64_t ternary;        // number of ternary resolution phases
   int64_t ternres;        // number of ternary resolutions
   int64_t htrs;           // number of hyper ternary resolvents
   int64_t htrs2;          // number of binary hyper ternary resolvents
   int64_t htrs3;          // number of ternary hyper ternary resolvents
   int64_t decompositions; // number of SCC + ELS
+  int64_t bingraphs;      // built binary implication graphs
+  int64_t bingraphreused; // reused binary implication graphs
   int64_t vivifications;  // number of vivifications
   int64_t vivifychecks;   // checked clauses during vivification
   int64_t vivifydecs;     // vivification decisions
@@ -195,6 +205,8 @@ struct Stats {
   int64_t vivifystred3;   // strengthened redundant clause (3)
   int64_t vivifyunits;    // units during vivification
   int64_t vivifyinst;     // instantiation during vivification
+  int64_t vivifypar;      // clauses vivified in parallel
+  int64_t vivifystale;    // parallel results dropped as stale
   int64_t transreds;
   int64_t transitive;
   struct {
@@ -217,6 +229,8 @@ struct Stats {
   int64_t probingrounds; // number of probing rounds
   int64_t probesuccess;  // number successful probing phases
   int64_t probed;        // number of probed literals
+  int64_t probepar;      // literals probed in parallel
+  int64_t probestale;    // parallel results dropped as stale
   int64_t failed;        // number of failed literals
   int64_t hyperunary;    // hyper unary resolved unit clauses
   int64_t probefailed;   // failed literals from probing
@@ -256,6 +270,39 @@ struct Stats {
     int64_t subsumed;     // number of clauses subsumed by OTFS
   } otfs;
 
+  struct {
+    int64_t rebuilt;   // occurrence lists rebuilt from scratch
+    int64_t updated;   // kept occurrence lists updated instead
+    int64_t flushed;   // stale occurrence lists flushed in updates
+    int64_t connected; // dirty clauses connected in updates
+  } occs;
+
+  static const int latency_buckets = 16;
+
+  struct {
+    int64_t calls;                         // number of 'solve' calls
+    int64_t suspended;                     // suspended inprocessing
+    int64_t solve[latency_buckets];        // histogram of 'solve' latency
+    int64_t inprocessing[latency_buckets]; // and inprocessing per call
+  } latency;
+
+  struct {
+    int64_t allocated; // clauses allocated on the slab
+    int64_t reused;    // allocated from free lists
+    int64_t recycled;  // recycled after moving garbage collection
+    int64_t bytes;     // bytes of all slab pages
+    int64_t live;      // bytes of allocated clauses on the slab
+    int64_t wasted;    // bytes too small for clauses since recycling
+  } slab;
+
+  struct {
+    int64_t mapped;      // bytes of large tables mapped (see 'pages.hpp')
+    int64_t peak;        // maximum of 'mapped'
+    int64_t transparent; // mapped bytes advised to use transparent pages
+    int64_t hugetlb;     // mapped bytes in explicitly reserved huge pages
+    int64_t bound;       // mapped bytes bound to the NUMA node
+  } pages;
+
   int64_t unused;   // number of unused variables
   int64_t active;   // number of active variables
   int64_t inactive; // number of inactive variables
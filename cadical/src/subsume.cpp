@@ -63,6 +63,8 @@ bool Internal::subsuming () {
     return false;
   if (!preprocessing && !opts.inprocessing)
     return false;
+  if (!preprocessing && inprocessing_suspended ())
+    return false;
   if (preprocessing)
     assert (lim.preprocessing);
 
@@ -158,6 +160,7 @@ inline void Internal::subsume_clause (Clause *subsuming, Clause *subsumed) {
   }
   LOG ("turning redundant subsuming clause into irredundant clause");
   subsuming->redundant = false;
+  mark_dirty (subsuming);
   if (proof)
     proof->strengthen (subsuming->id);
   mark_garbage (subsumed);
@@ -200,7 +203,7 @@ void Internal::strengthen_clause (Clause *c, int lit) {
 // strengthened the result is negative.  Otherwise the candidate clause
 // can not be subsumed nor strengthened and zero is returned.
 
-inline int Internal::try_to_subsume_clause (Clause *c,
+inline int Internal::try_to_subsume_clause (Subsumer &subsumer, Clause *c,
                                             vector<Clause *> &shrunken) {
 
   stats.subtried++;
@@ -208,6 +211,7 @@ inline int Internal::try_to_subsume_clause (Clause *c,
   LOG (c, "trying to subsume");
 
   mark (c); // signed!
+  const uint64_t sig = clause_signature (c);
 
   Clause *d = 0;
   int flipped = 0;
@@ -271,8 +275,14 @@ inline int Internal::try_to_subsume_clause (Clause *c,
       // code after the loop is used.
       //
       const Occs &os = occs (sign * lit);
+      const uint64_t *sigs = subsumer.sigs[vlit (sign * lit)].data ();
       for (const auto &e : os) {
         assert (!e->garbage); // sanity check
+        stats.subsigs++;
+        if (*sigs++ & ~sig) {
+          stats.subsigsrejected++;
+          continue;
+        }
         if (e->garbage)
           continue; // defensive: not needed
         flipped = subsume_check (e, c);
@@ -289,6 +299,16 @@ inline int Internal::try_to_subsume_clause (Clause *c,
 
   unmark (c);
 
+  return subsume_or_strengthen (c, d, flipped, shrunken);
+}
+
+// Subsume or strengthen the candidate clause 'c' as determined by the
+// result 'flipped' of 'subsume_check' for the clause 'd'.
+
+inline int Internal::subsume_or_strengthen (Clause *c, Clause *d,
+                                            int flipped,
+                                            vector<Clause *> &shrunken) {
+
   if (flipped == INT_MIN) {
     LOG (d, "subsuming");
     subsume_clause (d, c);
@@ -314,16 +334,230 @@ inline int Internal::try_to_subsume_clause (Clause *c,
 
 /*------------------------------------------------------------------------*/
 
-// Sorting the scheduled clauses is way faster if we compute and save the
-// clause size in the schedule to avoid pointer access to clauses during
-// sorting.  This slightly increases the schedule size though.
+// Parallel forward subsumption.  With 'opts.threads > 1' the schedule is
+// split into shards of 'opts.subsumeshard' consecutive candidates.  Before
+// a shard is processed all its candidates are checked in parallel against
+// the clauses connected by previous subsumer.  These clauses are not changed
+// while checking, which however means that we can not use 'subsume_check'
+// (it moves the failing literal to the front) and each worker thread needs
+// its own marks.  Then the shard is processed sequentially in schedule
+// order as before, except that candidates are only checked sequentially
+// against clauses connected in the current shard if the parallel check did
+// not find a subsuming or strengthening clause.  The result only depends on
+// the shard size and not on the number of threads.
+
+// Check whether the clause 'd' subsumes or strengthens the candidate with
+// literals marked in 'marks'.  Same result as 'subsume_check'.
+
+static int subsume_check_marked (Internal *internal, Clause *d,
+                                 const vector<signed char> &marks) {
+  int flipped = 0;
+  for (const auto &lit : *d) {
+    const int tmp = sign (lit) * marks[abs (lit)];
+    if (!tmp)
+      return 0;
+    if (tmp > 0)
+      continue;
+    if (flipped)
+      return 0;
+    flipped = lit;
+  }
+  if (!flipped)
+    return INT_MIN;
+  if (!internal->opts.subsumestr)
+    return 0;
+  return flipped;
+}
 
-struct ClauseSize {
-  size_t size;
-  Clause *clause;
-  ClauseSize (int s, Clause *c) : size (s), clause (c) {}
-  ClauseSize () {}
-};
+// Executed by worker threads, thus only reading the current state.  Same
+// search as in 'try_to_subsume_clause'.
+
+void Internal::subsume_check_candidate (Subsumer &subsumer, Clause *c,
+                                        SubsumeCandidate &res,
+                                        vector<signed char> &marks) {
+  res.clause = 0;
+  res.flipped = 0;
+  res.checks = res.checks2 = res.rejected = 0;
+  const uint64_t sig = clause_signature (c);
+
+  for (const auto &lit : *c)
+    marks[abs (lit)] = sign (lit);
+
+  for (const auto &lit : *c) {
+    if (!flags (lit).subsume)
+      continue;
+    for (int sign = -1; !res.clause && sign <= 1; sign += 2) {
+      for (const auto &bin : bins (sign * lit)) {
+        const auto &other = bin.lit;
+        const int tmp = CaDiCaL::sign (other) * marks[abs (other)];
+        if (!tmp)
+          continue;
+        if (tmp < 0 && sign < 0)
+          continue;
+        if (tmp < 0) {
+          res.binary[0] = lit;
+          res.flipped = other;
+        } else {
+          res.binary[0] = sign * lit;
+          res.flipped = (sign < 0) ? -lit : INT_MIN;
+        }
+        res.binary[1] = other;
+        res.id = bin.id;
+        res.clause = dummy_binary;
+        break;
+      }
+      if (res.clause)
+        break;
+      const uint64_t *sigs = subsumer.sigs[vlit (sign * lit)].data ();
+      for (const auto &e : occs (sign * lit)) {
+        assert (!e->garbage);
+        if (*sigs++ & ~sig) {
+          res.rejected++;
+          continue;
+        }
+        res.checks++;
+        if (e->size == 2)
+          res.checks2++;
+        res.flipped = subsume_check_marked (this, e, marks);
+        if (!res.flipped)
+          continue;
+        res.clause = e;
+        break;
+      }
+    }
+    if (res.clause)
+      break;
+  }
+
+  for (const auto &lit : *c)
+    marks[abs (lit)] = 0;
+}
+
+// Check the candidates of the next shard '[begin,end)' in parallel.
+
+void Internal::subsume_shard (Subsumer &subsumer,
+                              const vector<ClauseSize> &schedule,
+                              size_t begin, size_t end) {
+  subsumer.shard++;
+  stats.subshards++;
+  LOG ("checking subsumption shard %u of %zd candidates in parallel",
+       subsumer.shard, end - begin);
+  const size_t size = 2 * (max_var + 1);
+  if (subsumer.stamp.size () < size) {
+    subsumer.stamp.resize (size, 0);
+    subsumer.occs_start.resize (size);
+    subsumer.bins_start.resize (size);
+  }
+  const unsigned threads = opts.threads;
+  if (subsumer.marks.size () < threads)
+    subsumer.marks.resize (threads);
+  subsumer.checked.resize (end - begin);
+  parallel_jobs (threads, end - begin, [&] (unsigned worker, size_t i) {
+    Clause *c = schedule[begin + i].clause;
+    SubsumeCandidate &res = subsumer.checked[i];
+    if (c->size <= 2 || !c->subsume)
+      return;
+    vector<signed char> &marks = subsumer.marks[worker];
+    if (marks.size () <= (size_t) max_var)
+      marks.resize (max_var + 1, 0);
+    subsume_check_candidate (subsumer, c, res, marks);
+  });
+}
+
+// Remember the first literal connected in the current shard.
+
+inline void Internal::subsume_shard_connect (Subsumer &subsumer,
+                                             int lit) {
+  const unsigned idx = vlit (lit);
+  if (subsumer.stamp[idx] == subsumer.shard)
+    return;
+  subsumer.stamp[idx] = subsumer.shard;
+  subsumer.occs_start[idx] = occs (lit).size ();
+  subsumer.bins_start[idx] = bins (lit).size ();
+}
+
+// Sequential part of processing a candidate of the current shard.  If the
+// parallel check did not succeed we only have to check clauses connected
+// in this shard.
+
+int Internal::subsume_shard_candidate (Subsumer &subsumer, Clause *c,
+                                       const SubsumeCandidate &res,
+                                       vector<Clause *> &shrunken) {
+  stats.subtried++;
+  stats.subchecks += res.checks;
+  stats.subchecks2 += res.checks2;
+  stats.subparallel += res.checks;
+  stats.subsigs += res.checks + res.rejected;
+  stats.subsigsrejected += res.rejected;
+
+  Clause *d = res.clause;
+  int flipped = res.flipped;
+
+  if (d == dummy_binary) {
+    dummy_binary->literals[0] = res.binary[0];
+    dummy_binary->literals[1] = res.binary[1];
+    dummy_binary->id = res.id;
+  } else if (!d) {
+    LOG (c, "trying to subsume in shard");
+    mark (c);
+    const uint64_t sig = clause_signature (c);
+    for (const auto &lit : *c) {
+      if (!flags (lit).subsume)
+        continue;
+      for (int sign = -1; !d && sign <= 1; sign += 2) {
+        const unsigned idx = vlit (sign * lit);
+        if (subsumer.stamp[idx] != subsumer.shard)
+          continue;
+        const Bins &bs = bins (sign * lit);
+        for (size_t i = subsumer.bins_start[idx]; i < bs.size (); i++) {
+          const auto &other = bs[i].lit;
+          const int tmp = marked (other);
+          if (!tmp)
+            continue;
+          if (tmp < 0 && sign < 0)
+            continue;
+          if (tmp < 0) {
+            dummy_binary->literals[0] = lit;
+            flipped = other;
+          } else {
+            dummy_binary->literals[0] = sign * lit;
+            flipped = (sign < 0) ? -lit : INT_MIN;
+          }
+          dummy_binary->literals[1] = other;
+          dummy_binary->id = bs[i].id;
+          d = dummy_binary;
+          break;
+        }
+        if (d)
+          break;
+        const Occs &os = occs (sign * lit);
+        const Signatures &sigs = subsumer.sigs[idx];
+        for (size_t i = subsumer.occs_start[idx]; i < os.size (); i++) {
+          stats.subsigs++;
+          if (sigs[i] & ~sig) {
+            stats.subsigsrejected++;
+            continue;
+          }
+          Clause *e = os[i];
+          assert (!e->garbage);
+          flipped = subsume_check (e, c);
+          if (!flipped)
+            continue;
+          d = e;
+          break;
+        }
+      }
+      if (d)
+        break;
+    }
+    unmark (c);
+  } else
+    LOG (c, "parallel check succeeded for");
+
+  return subsume_or_strengthen (c, d, flipped, shrunken);
+}
+
+/*------------------------------------------------------------------------*/
 
 struct smaller_clause_size_rank {
   typedef size_t Type;
@@ -480,14 +714,27 @@ bool Internal::subsume_round () {
   init_occs ();
   init_bins ();
 
-  for (const auto &s : schedule) {
+  const bool parallel = (opts.threads > 1);
+  Subsumer subsumer;
+  subsumer.sigs.resize (2 * (max_var + 1));
+  size_t shard_begin = 0, shard_end = 0;
+
+  for (size_t i = 0; i < schedule.size (); i++) {
 
     if (terminated_asynchronously ())
       break;
+    if (inprocessing_suspended ())
+      break;
     if (stats.subchecks >= check_limit)
       break;
 
-    Clause *c = s.clause;
+    if (parallel && i == shard_end) {
+      shard_begin = i;
+      shard_end = min (i + (size_t) opts.subsumeshard, schedule.size ());
+      subsume_shard (subsumer, schedule, shard_begin, shard_end);
+    }
+
+    Clause *c = schedule[i].clause;
     assert (!c->garbage);
 
     checked++;
@@ -502,7 +749,11 @@ bool Internal::subsume_round () {
     //
     if (c->size > 2 && c->subsume) {
       c->subsume = false;
-      const int tmp = try_to_subsume_clause (c, shrunken);
+      const int tmp =
+          parallel ? subsume_shard_candidate (
+                         subsumer, c, subsumer.checked[i - shard_begin],
+                         shrunken)
+                   : try_to_subsume_clause (subsumer, c, shrunken);
       if (tmp > 0) {
         subsumed++;
         continue;
@@ -556,7 +807,11 @@ bool Internal::subsume_round () {
            "watching %d with %zd current and total %" PRId64 " occurrences",
            minlit, minsize, minoccs);
 
+      if (parallel)
+        subsume_shard_connect (subsumer, minlit);
       occs (minlit).push_back (c);
+      subsumer.sigs[vlit (minlit)].push_back (clause_signature (c));
+      assert (occs (minlit).size () == subsumer.sigs[vlit (minlit)].size ());
 
       // This sorting should give faster failures for assumption checks
       // since the less occurring variables are put first in a clause and
@@ -583,6 +838,8 @@ bool Internal::subsume_round () {
 
       const int minlit_pos = (c->literals[1] == minlit);
       const int other = c->literals[!minlit_pos];
+      if (parallel)
+        subsume_shard_connect (subsumer, minlit);
       bins (minlit).push_back (Bin{other, c->id});
     }
   }
@@ -679,6 +936,8 @@ UPDATE_LIMITS:
 
   if (!update_limits)
     return;
+  if (lim.latency.suspended)
+    return; // Resume in next 'solve' call.
 
   int64_t delta = scale (opts.subsumeint * (stats.subsumephases + 1));
   lim.subsume = stats.conflicts + delta;
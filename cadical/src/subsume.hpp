@@ -0,0 +1,70 @@
+#ifndef _subsume_hpp_INCLUDED
+#define _subsume_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+struct Clause;
+
+// Sorting the scheduled clauses is way faster if we compute and save the
+// clause size in the schedule to avoid pointer access to clauses during
+// sorting.  This slightly increases the schedule size though.
+
+struct ClauseSize {
+  size_t size;
+  Clause *clause;
+  ClauseSize (int s, Clause *c) : size (s), clause (c) {}
+  ClauseSize () {}
+};
+
+// With more than one thread the subsumption schedule is processed in
+// shards and the candidates of a shard are checked in parallel against the
+// clauses connected before (see 'subsume_shard' in 'subsume.cpp').
+
+struct SubsumeCandidate {
+  Clause *clause;   // subsuming or strengthening clause if non-zero
+  int flipped;      // as returned by 'subsume_check'
+  int binary[2];    // literals of subsuming binary clause in 'bins'
+  uint64_t id;      // and its identifier
+  int64_t checks;   // number of subsumption checks
+  int64_t checks2;  // same but restricted to binary clauses
+  int64_t rejected; // checks avoided by clause signatures
+};
+
+// Clause signatures are 64-bit Bloom filters over the variables of a
+// clause.  If a clause 'd' subsumes or strengthens 'c' then all variables
+// of 'd' occur in 'c' and thus the signature of 'd' is included in the one
+// of 'c'.  Most pairs are rejected by this test without accessing the
+// literals of 'd'.  Signatures are computed when connecting a clause
+// during a subsumption round and are kept in the side table 'sigs' which
+// has one signature for each entry in the occurrence lists.
+
+inline uint64_t variable_signature (int lit) {
+  const unsigned idx = lit < 0 ? -lit : lit;
+  return (uint64_t) 1 << ((idx * 0x9e3779b1u) >> 26);
+}
+
+inline uint64_t clause_signature (const Clause *c) {
+  uint64_t res = 0;
+  for (const auto &lit : *c)
+    res |= variable_signature (lit);
+  return res;
+}
+
+typedef vector<uint64_t> Signatures;
+
+struct Subsumer {
+  vector<Signatures> sigs; // signatures of 'occs' entries per literal
+
+  unsigned shard;                    // current shard (starting with one)
+  vector<unsigned> stamp;            // shard a literal was connected in
+  vector<size_t> occs_start;         // size of 'occs' at that point
+  vector<size_t> bins_start;         // size of 'bins' at that point
+  vector<SubsumeCandidate> checked;  // candidate results of current shard
+  vector<vector<signed char>> marks; // scratch marks per worker thread
+
+  Subsumer () : shard (0) {}
+};
+
+} // namespace CaDiCaL
+
+#endif
@@ -197,8 +197,6 @@ void Internal::ternary_lit (int pivot, int64_t &steps, int64_t &htrs) {
           lrat_chain.push_back (d->id);
         }
         Clause *r = new_hyper_ternary_resolved_clause (red);
-        if (red)
-          r->hyper = true;
         lrat_chain.clear ();
         clause.clear ();
         LOG (r, "hyper ternary resolved");
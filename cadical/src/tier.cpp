@@ -0,0 +1,158 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Put a new redundant clause on the stack of its initial tier.
+
+void Internal::tier_clause (Clause *c) {
+  assert (c->redundant);
+  assert (!c->tier);
+  unsigned tier;
+  if (c->keep)
+    tier = 1;
+  else if (c->glue <= opts.reducetier2glue)
+    tier = 2;
+  else
+    tier = 3;
+  c->tier = tier;
+  tiers[tier].push_back (c);
+}
+
+// Hyper binary and ternary resolvents are only kept for one reduce round
+// unless used, independent of their (low) glue.  Thus they are moved from
+// the stack determined in 'new_clause' to the local stack.
+
+void Internal::mark_hyper (Clause *c) {
+  assert (c->redundant);
+  assert (!c->hyper);
+  c->hyper = true;
+  vector<Clause *> &stack = tiers[c->tier];
+  assert (!stack.empty () && stack.back () == c);
+  stack.pop_back ();
+  c->tier = 3;
+  tiers.local.push_back (c);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Traverse the local stack during 'reduce'.  Clauses promoted since the
+// last 'reduce' are moved to the stack of their new tier.  Otherwise this
+// is the same policy as for all redundant clauses before: unless they are
+// reasons, their 'used' counter is decremented and unused ones become
+// candidates for reduction, except for hyper resolvents which are directly
+// marked as garbage.
+
+void Internal::collect_local_clauses (vector<Clause *> &candidates) {
+  vector<Clause *> &local = tiers.local;
+  const auto end = local.end ();
+  auto j = local.begin (), i = j;
+  while (i != end) {
+    Clause *c = *i++;
+    if (c->garbage || !c->redundant)
+      continue;
+    if (c->tier != 3) {
+      tiers[c->tier].push_back (c);
+      continue;
+    }
+    *j++ = c;
+    if (c->reason)
+      continue;
+    const unsigned used = c->used;
+    if (used)
+      c->used--;
+    if (c->hyper) {
+      assert (c->size <= 3);
+      if (!used)
+        mark_garbage (c);
+      continue;
+    }
+    if (used)
+      continue;
+    assert (!c->keep);
+    candidates.push_back (c);
+  }
+  local.resize (j - local.begin ());
+}
+
+// Tier two clauses not used in the last two 'reduce' intervals are moved
+// to the local stack and become reduction candidates.  If there are still
+// more than 'opts.reducetier2max' tier two clauses, also those not used
+// in the last interval are demoted, starting with the oldest ones.
+
+void Internal::demote_tier2_clauses (vector<Clause *> &candidates) {
+  vector<Clause *> &tier2 = tiers.tier2;
+  const auto end = tier2.end ();
+  auto j = tier2.begin (), i = j;
+  while (i != end) {
+    Clause *c = *i++;
+    if (c->garbage || !c->redundant)
+      continue;
+    if (c->tier == 1) {
+      tiers.core.push_back (c);
+      continue;
+    }
+    if (c->reason) {
+      *j++ = c;
+      continue;
+    }
+    const unsigned used = c->used;
+    if (used) {
+      c->used--;
+      *j++ = c;
+      continue;
+    }
+    LOG (c, "demoting unused");
+    c->tier = 3;
+    tiers.local.push_back (c);
+    candidates.push_back (c);
+    stats.demoted++;
+  }
+  tier2.resize (j - tier2.begin ());
+
+  const size_t max = opts.reducetier2max;
+  if (tier2.size () <= max)
+    return;
+
+  size_t excess = tier2.size () - max;
+  j = tier2.begin ();
+  for (i = j; i != tier2.end (); i++) {
+    Clause *c = *i;
+    if (excess && !c->used && !c->reason) {
+      LOG (c, "demoting excess");
+      c->tier = 3;
+      tiers.local.push_back (c);
+      stats.demoted++;
+      excess--;
+    } else
+      *j++ = c;
+  }
+  tier2.resize (j - tier2.begin ());
+}
+
+/*------------------------------------------------------------------------*/
+
+// Remove collected clauses from the tier stacks and update references to
+// moved clauses.  This has to happen before the old clauses are deleted.
+
+void Internal::flush_tiers () {
+  for (unsigned tier = 1; tier <= 3; tier++) {
+    vector<Clause *> &stack = tiers[tier];
+    const auto end = stack.end ();
+    auto j = stack.begin (), i = j;
+    while (i != end) {
+      Clause *c = *i++;
+      if (c->collect ())
+        continue;
+      if (!c->redundant)
+        continue;
+      *j++ = c->moved ? c->copy : c;
+    }
+    stack.resize (j - stack.begin ());
+    if (stack.size () < stack.capacity () / 2)
+      shrink_vector (stack);
+  }
+}
+
+} // namespace CaDiCaL
@@ -0,0 +1,35 @@
+#ifndef _tier_hpp_INCLUDED
+#define _tier_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+using namespace std;
+
+struct Clause;
+
+// Redundant clauses are kept on three separate stacks according to their
+// tier (see the discussion of tiers in 'clause.hpp').  Tier one ('core')
+// clauses are never reduced, thus 'reduce' only needs to traverse the
+// 'tier2' and 'local' stacks and sorts only the candidates on 'local'.
+//
+// The tier of a clause is stored in 'Clause.tier' and is updated eagerly
+// during promotion in conflict analysis, while clauses are moved between
+// the stacks lazily during the next 'reduce'.  Thus every redundant clause
+// is on exactly one stack which does not have to match its current tier.
+// Garbage and no-longer redundant clauses are flushed during garbage
+// collection (see 'flush_tiers' in 'tier.cpp').
+
+struct Tiers {
+  vector<Clause *> core;  // tier one: glue at most 'reducetier1glue'
+  vector<Clause *> tier2; // tier two: glue at most 'reducetier2glue'
+  vector<Clause *> local; // tier three: reduce candidates
+
+  vector<Clause *> &operator[] (unsigned tier) {
+    assert (1 <= tier && tier <= 3);
+    return tier == 1 ? core : tier == 2 ? tier2 : local;
+  }
+};
+
+} // namespace CaDiCaL
+
+#endif
@@ -68,10 +68,14 @@ void Internal::transred () {
     i = clauses.begin ();
   }
 
-  // Move watches of binary clauses to the front. Thus we can stop iterating
-  // watches as soon a long clause is found during watch traversal.
+  // Traverse the shared binary implication graph instead of the watches.
+  // Clauses removed below stay in the graph until the end of this round,
+  // thus we have to check the reason of each edge for being garbage.
   //
-  sort_watches ();
+  const BinaryGraph &graph = binary_graph ();
+  const auto &start = graph.start;
+  const auto &children = graph.children;
+  const auto &reasons = graph.reasons;
 
   // This working stack plays the same role as the 'trail' during standard
   // propagation.
@@ -106,13 +110,14 @@ void Internal::transred () {
     // Find a different path from 'src' to 'dst' in the binary implication
     // graph, not using 'c'.  Since this is the same as checking whether
     // there is a path from '-dst' to '-src', we can do the reverse search
-    // if the number of watches of '-dst' is larger than those of 'src'.
+    // if the number of edges of '-dst' is larger than those of 'src'.
     //
     int src = -c->literals[0];
     int dst = c->literals[1];
     if (val (src) || val (dst))
       continue;
-    if (watches (-src).size () < watches (dst).size ()) {
+    const unsigned usrc = vlit (src), udst = vlit (-dst);
+    if (start[usrc + 1] - start[usrc] < start[udst + 1] - start[udst]) {
       int tmp = dst;
       dst = -src;
       src = -tmp;
@@ -145,21 +150,17 @@ void Internal::transred () {
       assert (marked (lit) > 0);
       LOG ("transred propagating %d", lit);
       propagations++;
-      const Watches &ws = watches (-lit);
-      const const_watch_iterator eow = ws.end ();
-      const_watch_iterator k;
-      for (k = ws.begin (); !transitive && !failed && k != eow; k++) {
-        const Watch &w = *k;
-        if (!w.binary ())
-          break; // since we sorted watches above
-        Clause *d = w.clause;
+      const size_t eoe = start[vlit (lit) + 1];
+      for (size_t k = start[vlit (lit)]; !transitive && !failed && k != eoe;
+           k++) {
+        Clause *d = reasons[k];
         if (d == c)
           continue;
         if (irredundant && d->redundant)
           continue;
         if (d->garbage)
           continue;
-        const int other = w.blit;
+        const int other = children[k];
         if (other == dst)
           transitive = true; // 'dst' reached
         else {
@@ -240,6 +241,7 @@ void Internal::transred () {
   last.transred.propagations = stats.propagations.search;
   stats.propagations.transred += propagations;
   erase_vector (work);
+  reset_binary_graph ();
 
   PHASE ("transred", stats.transreds,
          "removed %" PRId64 " transitive clauses, found %" PRId64 " units",
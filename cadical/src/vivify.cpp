@@ -130,7 +130,7 @@ bool Internal::vivify_propagate () {
         const int other = lits[0] ^ lits[1] ^ lit;
         const signed char u = val (other);
         if (u > 0)
-          j[-1].blit = other;
+          j[-1].update_blit (other);
         else {
           const int size = w.clause->size;
           const const_literal_iterator end = lits + size;
@@ -149,7 +149,7 @@ bool Internal::vivify_propagate () {
           w.clause->pos = k - lits;
           assert (lits + 2 <= k), assert (k <= w.clause->end ());
           if (v > 0)
-            j[-1].blit = r;
+            j[-1].update_blit (r);
           else if (!v) {
             LOG (w.clause, "unwatch %d in", r);
             lits[0] = other;
@@ -1079,6 +1079,425 @@ inline void Internal::vivify_chain_for_units (int lit, Clause *reason) {
 
 /*------------------------------------------------------------------------*/
 
+// Parallel vivification of redundant clauses.  With 'opts.threads > 1' the
+// schedule of the redundant round is processed in batches of a fixed number
+// of slices, each with 'opts.vivifyslice' consecutive candidates.  Worker
+// threads vivify the candidates of a slice one after the other (reusing
+// decisions as above) on a read-only snapshot of the irredundant and the
+// redundant clauses likely to be kept, taken at the start of the round.
+// Large clauses are propagated by counting false literals, since the
+// snapshot can not be changed to move watches.  The result of each
+// candidate, i.e., whether it can be removed or its strengthened clause
+// with its LRAT chain, is then committed sequentially in schedule order.
+// Strengthened clauses are only committed if all clauses used to derive
+// them are still present, which keeps the proof valid.  Clauses added
+// during the round are not in the snapshot, which only makes vivification
+// weaker.  The result depends on the slice size but not on the number of
+// threads.
+
+// The following functions are executed by worker threads and thus only
+// read the solver state.  They follow 'vivify_analyze_redundant',
+// 'vivify_post_process_analysis' and 'vivify_build_lrat' above.
+
+void Internal::vivify_parallel_analyze (SnapshotWorker &worker, int start,
+                                        bool &only_binary_reasons) {
+  const Snapshot &snapshot = *worker.snapshot;
+  only_binary_reasons = true;
+  auto &stack = worker.stack;
+  assert (stack.empty ());
+  stack.push_back (start);
+  while (!stack.empty ()) {
+    const int c = stack.back ();
+    stack.pop_back ();
+    if (snapshot.clauses[c]->size > 2)
+      only_binary_reasons = false;
+    const int *lits = snapshot.literals.data () + snapshot.start[c];
+    for (const int *k = lits; k != lits + snapshot.size (c); k++) {
+      const int lit = *k, idx = abs (lit);
+      if (worker.seen[idx])
+        continue;
+      assert (worker.val (lit) < 0);
+      worker.seen[idx] = 1;
+      worker.analyzed.push_back (idx);
+      const int reason = worker.reasons[idx];
+      if (reason >= 0)
+        stack.push_back (reason);
+    }
+  }
+}
+
+void Internal::vivify_parallel_post_process (SnapshotWorker &worker,
+                                             Clause *c, int subsume,
+                                             vector<int> &clause) {
+  assert (clause.empty ());
+  const auto &root = worker.snapshot->vals;
+  bool all_decisions = true;
+  for (const auto &other : *c) {
+    if (other == subsume)
+      continue;
+    if (worker.val (other) >= 0)
+      all_decisions = false;
+    else if (root[Snapshot::vlit (other)])
+      continue;
+    else if (worker.reasons[abs (other)] >= 0)
+      all_decisions = false;
+    else if (!worker.seen[abs (other)])
+      all_decisions = false;
+    if (!all_decisions)
+      break;
+  }
+  if (all_decisions)
+    return;
+  for (const auto &other : *c) {
+    const int idx = abs (other);
+    if (other == subsume)
+      clause.push_back (other);
+    else if (worker.val (other) >= 0)
+      continue;
+    else if (root[Snapshot::vlit (other)])
+      continue;
+    else if (worker.reasons[idx] >= 0)
+      continue;
+    else if (worker.seen[idx])
+      clause.push_back (other);
+  }
+}
+
+void Internal::vivify_parallel_justify (SnapshotWorker &worker, int lit,
+                                        Clause *reason, VivifyResult &res) {
+  for (const auto &other : *reason) {
+    if (other == lit)
+      continue;
+    const int idx = abs (other);
+    if (worker.seen[idx])
+      continue;
+    worker.seen[idx] = 1;
+    worker.analyzed.push_back (idx);
+    if (worker.snapshot->vals[Snapshot::vlit (other)]) {
+      if (lrat)
+        res.chain.push_back (unit_clauses[vlit (-other)]);
+      continue;
+    }
+    const int r = worker.reasons[idx];
+    if (worker.val (other) && r >= 0)
+      vivify_parallel_justify (worker, other, worker.snapshot->clauses[r],
+                               res);
+  }
+  if (lrat)
+    res.chain.push_back (reason->id);
+  res.antecedents.push_back (reason);
+}
+
+// Same as 'vivify_clause' in redundant mode on the worker state.
+
+void Internal::vivify_parallel_clause (SnapshotWorker &worker, Clause *c,
+                                       VivifyResult &res) {
+  const Snapshot &snapshot = *worker.snapshot;
+
+  res.result = VivifyResult::FAILED;
+  res.strengthened = 0;
+  res.instantiated = false;
+  res.decisions = res.reused = 0;
+  const int64_t propagations = worker.propagations;
+
+  if (c->garbage)
+    return;
+
+  auto &sorted = worker.sorted;
+  sorted.clear ();
+
+  for (const auto &lit : *c) {
+    const signed char tmp = snapshot.vals[Snapshot::vlit (lit)];
+    if (tmp > 0)
+      return;
+    if (!tmp)
+      sorted.push_back (lit);
+  }
+
+  if (sorted.size () < 2)
+    return;
+
+  sort (sorted.begin (), sorted.end (), vivify_more_noccs (this));
+
+  const int index = snapshot.find (c, sorted.back ());
+  if (index < 0)
+    return;
+
+  if (worker.level) {
+    int forced = 0;
+    for (const auto &lit : sorted) {
+      const signed char tmp = worker.val (lit);
+      if (tmp < 0)
+        continue;
+      if (tmp > 0 && worker.reasons[abs (lit)] == index)
+        forced = lit;
+      break;
+    }
+    if (forced)
+      worker.backtrack (worker.levels[abs (forced)] - 1);
+
+    if (worker.level) {
+      int l = 1;
+      for (const auto &lit : sorted) {
+        const int decision = worker.trail[worker.control[l - 1]];
+        if (-lit == decision) {
+          res.reused++;
+          if (++l > worker.level)
+            break;
+        } else {
+          worker.backtrack (l - 1);
+          break;
+        }
+      }
+    }
+  }
+
+  worker.ignore = index;
+
+  int subsume = 0, remove = 0;
+  bool only_binary_reasons = false;
+
+  for (const auto &lit : sorted) {
+
+    if (subsume)
+      break;
+
+    const signed char tmp = worker.val (lit);
+
+    if (tmp) {
+
+      const int reason = worker.reasons[abs (lit)];
+      if (reason < 0)
+        continue;
+
+      if (tmp > 0) {
+        subsume = lit;
+        worker.seen[abs (lit)] = 1;
+        worker.analyzed.push_back (abs (lit));
+        vivify_parallel_analyze (worker, reason, only_binary_reasons);
+        if (!only_binary_reasons)
+          vivify_parallel_post_process (worker, c, subsume, res.clause);
+        worker.clear_analyzed ();
+        if (!res.clause.empty ()) {
+          res.strengthened = 2;
+          vivify_parallel_justify (worker, lit, snapshot.clauses[reason],
+                                   res);
+          worker.clear_analyzed ();
+        }
+        worker.backtrack (worker.level - 1);
+        break;
+      }
+
+      remove = lit;
+
+    } else {
+
+      res.decisions++;
+      worker.assume (-lit);
+
+      if (worker.propagate ())
+        continue;
+
+      subsume = INT_MIN;
+
+      const int conflict = worker.conflict;
+      vivify_parallel_analyze (worker, conflict, only_binary_reasons);
+      if (!only_binary_reasons)
+        vivify_parallel_post_process (worker, c, subsume, res.clause);
+      worker.clear_analyzed ();
+      if (!res.clause.empty ()) {
+        res.strengthened = 3;
+        vivify_parallel_justify (worker, 0, snapshot.clauses[conflict],
+                                 res);
+        worker.clear_analyzed ();
+      }
+      worker.backtrack (worker.level - 1);
+      worker.conflict = -1;
+      break;
+    }
+  }
+
+  if (opts.vivifyinst && !subsume) {
+    const int lit = sorted.back ();
+    if (remove != lit) {
+      worker.backtrack (worker.level - 1);
+      assert (!worker.val (lit));
+      res.decisions++;
+      worker.assume (lit);
+      if (!worker.propagate ()) {
+        res.instantiated = true;
+        vivify_parallel_justify (worker, 0, c, res);
+        vivify_parallel_justify (worker, 0,
+                                 snapshot.clauses[worker.conflict], res);
+        worker.clear_analyzed ();
+        remove = lit;
+        worker.backtrack (worker.level - 1);
+        worker.conflict = -1;
+      }
+    }
+  }
+
+  worker.ignore = -1;
+
+  if (subsume) {
+    if (only_binary_reasons)
+      res.result = VivifyResult::SUBSUMED;
+    else if (!res.clause.empty ())
+      res.result = VivifyResult::STRENGTHENED;
+  } else if (remove) {
+    for (const auto &other : *c) {
+      if (snapshot.vals[Snapshot::vlit (other)])
+        continue;
+      if (worker.val (other) && worker.reasons[abs (other)] >= 0)
+        continue;
+      if (other == remove)
+        continue;
+      res.clause.push_back (other);
+    }
+    if (!res.strengthened)
+      res.strengthened = 1;
+    if (res.antecedents.empty ()) {
+      vivify_parallel_justify (worker, 0, c, res);
+      worker.clear_analyzed ();
+    }
+    res.result = VivifyResult::STRENGTHENED;
+  }
+
+  res.propagations = worker.propagations - propagations;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Sequential part of processing the result of a candidate.
+
+void Internal::vivify_parallel_commit (Clause *c, VivifyResult &res) {
+
+  c->vivify = false;
+  c->vivified = true;
+
+  stats.propagations.vivify += res.propagations;
+  stats.vivifydecs += res.decisions;
+  stats.vivifyreused += res.reused;
+
+  if (c->garbage)
+    return;
+
+  for (const auto &lit : *c)
+    if (fixed (lit) > 0) {
+      LOG (c, "satisfied by propagated unit %d", lit);
+      mark_garbage (c);
+      return;
+    }
+
+  stats.vivifychecks++;
+  stats.vivifypar++;
+
+  if (res.instantiated)
+    stats.vivifyinst++;
+
+  if (res.result == VivifyResult::SUBSUMED) {
+    stats.vivifysubs++;
+    LOG (c, "redundant asymmetric tautology");
+    mark_garbage (c);
+    return;
+  }
+
+  if (res.result != VivifyResult::STRENGTHENED)
+    return;
+
+  bool stale = false;
+  for (const auto &d : res.antecedents)
+    if (d->garbage) {
+      LOG (d, "stale antecedent");
+      stale = true;
+      break;
+    }
+  for (const auto &lit : res.clause)
+    if (!stale && fixed (lit)) {
+      LOG ("stale literal %d", lit);
+      stale = true;
+    }
+  if (stale) {
+    LOG (c, "dropping stale vivification result of");
+    stats.vivifystale++;
+    return;
+  }
+
+  if (res.strengthened == 1)
+    stats.vivifystred1++;
+  else if (res.strengthened == 2)
+    stats.vivifystred2++;
+  else
+    stats.vivifystred3++;
+
+  assert (clause.empty ());
+  assert (lrat_chain.empty ());
+  swap (clause, res.clause);
+  swap (lrat_chain, res.chain);
+  vivify_strengthen (c);
+}
+
+void Internal::vivify_parallel (Vivifier &vivifier, int64_t limit) {
+
+  assert (vivifier.redundant_mode);
+  assert (!level);
+
+  Snapshot snapshot;
+  init_snapshot (snapshot, true);
+  PHASE ("vivify", stats.vivifications,
+         "snapshot of %zd clauses with %zd literals",
+         snapshot.clauses.size (), snapshot.literals.size ());
+
+  // The batch size only depends on the slice size and not on the number of
+  // threads to make the result deterministic.
+  //
+  const size_t slice = opts.vivifyslice;
+  const size_t batch_size = 64 * slice;
+
+  const unsigned threads = opts.threads;
+  vector<SnapshotWorker> workers (threads, SnapshotWorker (&snapshot));
+
+  auto &schedule = vivifier.schedule;
+  vector<Clause *> batch;
+  vector<VivifyResult> results;
+
+  while (!unsat && !terminated_asynchronously () &&
+         !inprocessing_suspended () && !schedule.empty () &&
+         stats.propagations.vivify < limit) {
+
+    batch.clear ();
+    while (!schedule.empty () && batch.size () < batch_size) {
+      batch.push_back (schedule.back ());
+      schedule.pop_back ();
+    }
+    results.resize (batch.size ());
+
+    const size_t slices = (batch.size () + slice - 1) / slice;
+    LOG ("vivifying %zd candidates in %zd slices in parallel",
+         batch.size (), slices);
+
+    parallel_jobs (threads, slices, [&] (unsigned w, size_t i) {
+      SnapshotWorker &worker = workers[w];
+      if (worker.vals.empty ())
+        worker.init ();
+      const size_t begin = i * slice;
+      const size_t end = min (begin + slice, batch.size ());
+      for (size_t j = begin; j < end; j++) {
+        results[j].clause.clear ();
+        results[j].chain.clear ();
+        results[j].antecedents.clear ();
+        vivify_parallel_clause (worker, batch[j], results[j]);
+      }
+      worker.backtrack (0);
+    });
+
+    for (size_t i = 0; !unsat && i < batch.size (); i++)
+      vivify_parallel_commit (batch[i], results[i]);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 // There are two modes of vivification, one using all clauses and one
 // focusing on irredundant clauses only.  The latter variant working on
 // irredundant clauses only can also remove irredundant asymmetric
@@ -1200,12 +1619,16 @@ void Internal::vivify_round (bool redundant_mode,
     learn_empty_clause ();
   }
 
-  while (!unsat && !terminated_asynchronously () &&
-         !vivifier.schedule.empty () && stats.propagations.vivify < limit) {
-    Clause *c = vivifier.schedule.back (); // Next candidate.
-    vivifier.schedule.pop_back ();
-    vivify_clause (vivifier, c);
-  }
+  if (redundant_mode && opts.threads > 1)
+    vivify_parallel (vivifier, limit);
+  else
+    while (!unsat && !terminated_asynchronously () &&
+           !inprocessing_suspended () && !vivifier.schedule.empty () &&
+           stats.propagations.vivify < limit) {
+      Clause *c = vivifier.schedule.back (); // Next candidate.
+      vivifier.schedule.pop_back ();
+      vivify_clause (vivifier, c);
+    }
 
   if (level)
     backtrack ();
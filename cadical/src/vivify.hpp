@@ -18,6 +18,23 @@ struct Vivifier {
   }
 };
 
+// Result of vivifying a candidate in parallel, committed sequentially.
+
+struct VivifyResult {
+  enum {
+    FAILED = 0,
+    SUBSUMED = 1,
+    STRENGTHENED = 2,
+  };
+  int result;
+  int strengthened;     // which case of 'vivifystred1-3' if strengthened
+  bool instantiated;    // last literal removed by instantiation
+  int64_t decisions, reused, propagations;
+  vector<int> clause;   // strengthened clause
+  vector<uint64_t> chain; // and its LRAT chain (if 'lrat' is set)
+  vector<Clause *> antecedents; // clauses used to derive it
+};
+
 } // namespace CaDiCaL
 
 #endif
@@ -148,7 +148,7 @@ unsigned Internal::walk_break_value (int lit) {
 
       // Found 'other' as second satisfying literal.
 
-      w.blit = other; // Update 'blit'
+      w.update_blit (other); // Update 'blit'
       *begin = other; // and move to front.
 
       break;
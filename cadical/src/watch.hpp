@@ -2,6 +2,7 @@
 #define _watch_hpp_INCLUDED
 
 #include <cassert>
+#include <cstdlib>
 #include <vector>
 
 namespace CaDiCaL {
@@ -13,7 +14,9 @@ namespace CaDiCaL {
 // one could use a 32-bit reference instead of the pointer which would
 // however limit the number of clauses to '2^32 - 1'.  One would also need
 // to use at least one more bit (either taken away from the variable space
-// or the clauses) to denote whether the watch is binary.
+// or the clauses) to denote whether the watch is binary.  Compiled with
+// '-DCLAUSEREFS' we use such a reference but keep the size, which gives a
+// 12 byte structure and limits the clause memory to 32 GB instead.
 
 // in fashion of Intel Sat 10.4230/LIPIcs.SAT.2022.8 we try to
 // guarantee the following invariant:
@@ -24,18 +27,67 @@ namespace CaDiCaL {
 // and    its level is smaller than the level of the watched literal
 //
 
-struct Clause;
+// Ternary clauses can optionally store their third literal inline, that is
+// the literal which is neither the watched literal nor the blocking
+// literal (see 'opts.inlineternary').  Then 'propagate' can check both
+// other literals of a ternary clause without accessing the clause.  The
+// third literal is stored in the 'size' field as negative number, which
+// thus doubles as flag for inlined ternary watches.  Note that we only
+// maintain the invariant that blocking and third literal are the two
+// literals of the clause which are different from the watched literal, in
+// any order.  This invariant is independent of the position of literals in
+// the clause and thus does not need to be updated if watches are moved.
+// Only if literals of ternary clauses are replaced or removed the watches
+// have to be updated (by 'update_watch_size' or 'flush_watches').  The
+// blocking literal of inlined ternary watches should only be replaced
+// through 'update_blit', which swaps blocking and third literal if needed.
 
 struct Watch {
 
+#ifdef CLAUSEREFS
+  ClauseRef clause; // 32-bit reference (see 'arena.hpp').
+#else
   Clause *clause;
+#endif
   int blit;
-  int size;
+  int size; // or negative encoding of third literal
 
   Watch (int b, Clause *c) : clause (c), blit (b), size (c->size) {}
+  Watch (int b, int t, Clause *c) : clause (c), blit (b) {
+    assert (c->size == 3);
+    set_third (t);
+  }
   Watch () {}
 
   bool binary () const { return size == 2; }
+  bool ternary () const { return size < 0; }
+
+  // The encoding requires '2 * idx + 1' to fit into an 'int'.
+  //
+  static bool inlinable (int lit) { return abs (lit) < (1 << 30); }
+
+  int third () const {
+    assert (ternary ());
+    const unsigned tmp = ~(unsigned) size;
+    const int idx = tmp >> 1;
+    return (tmp & 1) ? -idx : idx;
+  }
+
+  void set_third (int lit) {
+    assert (inlinable (lit));
+    const unsigned tmp = 2u * abs (lit) + (lit < 0);
+    size = ~(int) tmp;
+    assert (ternary ());
+    assert (third () == lit);
+  }
+
+  void update_blit (int new_blit) {
+    if (ternary () && new_blit != blit) {
+      assert (new_blit == third ());
+      set_third (blit);
+    }
+    blit = new_blit;
+  }
 };
 
 typedef vector<Watch> Watches; // of one literal
@@ -0,0 +1,86 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+// Random 3-CNF around the threshold with some conflicts spent in the
+// original solver before cloning, such that the clone gets redundant
+// clauses, phases and scores.  Then the clone and a copy have to agree on
+// the result for the same assumptions and models of the clone have to
+// satisfy the original clauses.
+
+static uint64_t state = 42;
+
+static int pick (int n) {
+  state = state * 6364136223846793005ul + 1442695040888963407ul;
+  return (state >> 33) % n;
+}
+
+static void check_model (Solver &solver,
+                         const vector<vector<int>> &clauses) {
+  for (const auto &c : clauses) {
+    bool satisfied = false;
+    for (const auto &lit : c)
+      if (solver.val (lit) > 0)
+        satisfied = true;
+    assert (satisfied);
+  }
+}
+
+int main () {
+  const int vars = 120, rounds = 10;
+  for (int round = 0; round < rounds; round++) {
+    vector<vector<int>> clauses;
+    Solver original;
+    const int n = 4.2 * vars;
+    for (int i = 0; i < n; i++) {
+      vector<int> c;
+      for (int j = 0; j < 3; j++) {
+        const int idx = 1 + pick (vars);
+        c.push_back (pick (2) ? idx : -idx);
+      }
+      for (const auto &lit : c)
+        original.add (lit);
+      original.add (0);
+      clauses.push_back (c);
+    }
+    for (int idx = 1; idx <= 10; idx++)
+      original.freeze (idx);
+    original.limit ("conflicts", 100);
+    int res = original.solve ();
+    assert (!res || res == 10 || res == 20);
+
+    Solver clone, copy;
+    original.clone (clone);
+    original.copy (copy);
+    for (int i = 0; i < 4; i++) {
+      const int lit = (1 + pick (10)) * (pick (2) ? 1 : -1);
+      clone.assume (lit);
+      copy.assume (lit);
+      const int clone_res = clone.solve ();
+      const int copy_res = copy.solve ();
+      cout << "round " << round << " assume " << lit << " clone "
+           << clone_res << " copy " << copy_res << endl;
+      assert (clone_res == copy_res);
+      if (clone_res == 10) {
+        assert (clone.val (lit) > 0);
+        check_model (clone, clauses);
+      }
+    }
+    const int clone_res = clone.solve ();
+    const int copy_res = copy.solve ();
+    assert (clone_res == copy_res);
+    if (clone_res == 10)
+      check_model (clone, clauses);
+  }
+  return 0;
+}
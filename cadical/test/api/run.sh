@@ -113,6 +113,8 @@ run cfreeze
 run traverse
 run cipasir
 run incproof
+run snapshot
+run clone
 
 if [ "`grep DNTRACING $makefile`" = "" ]
 then
@@ -0,0 +1,130 @@
+#include "../../src/cadical.hpp"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace CaDiCaL;
+
+static string path (const char *suffix) {
+  const char *prefix = getenv ("CADICALBUILD");
+  string res = prefix ? prefix : ".";
+  res += "/test-api-snapshot.";
+  res += suffix;
+  return res;
+}
+
+// Chain of equivalences 'x_1 = x_2 = ... = x_n' and a few gates on top,
+// which gives variable elimination and equivalent literal substitution
+// something to do before saving the snapshot.
+
+static const int n = 50;
+
+static void encode (Solver &solver, vector<vector<int>> &clauses) {
+  for (int i = 1; i < n; i++) {
+    clauses.push_back ({-i, i + 1});
+    clauses.push_back ({i, -(i + 1)});
+  }
+  for (int i = 1; i + 2 <= n; i += 3) {
+    const int g = n + i;
+    clauses.push_back ({-g, i});
+    clauses.push_back ({-g, i + 2});
+    clauses.push_back ({g, -i, -(i + 2)});
+  }
+  for (const auto &c : clauses) {
+    for (const auto &lit : c)
+      solver.add (lit);
+    solver.add (0);
+  }
+}
+
+static void check_model (Solver &solver,
+                         const vector<vector<int>> &clauses) {
+  for (const auto &c : clauses) {
+    bool satisfied = false;
+    for (const auto &lit : c)
+      if (solver.val (lit) > 0)
+        satisfied = true;
+    assert (satisfied);
+  }
+}
+
+int main () {
+
+  vector<vector<int>> clauses;
+
+  Solver original;
+  original.set ("elimrounds", 3);
+  encode (original, clauses);
+  original.freeze (1);
+  original.freeze (n + 1);
+  int res = original.simplify (2);
+  assert (!res);
+
+  const string image = path ("image");
+  const char *err = original.save_snapshot (image.c_str ());
+  if (err)
+    cerr << err << endl;
+  assert (!err);
+
+  Solver loaded;
+  err = loaded.load_snapshot (image.c_str ());
+  if (err)
+    cerr << err << endl;
+  assert (!err);
+  assert (loaded.get ("elimrounds") == 3);
+
+  // The snapshot has the same models as the original formula.
+
+  res = loaded.solve ();
+  assert (res == 10);
+  check_model (loaded, clauses);
+
+  loaded.assume (n);
+  res = loaded.solve ();
+  assert (res == 10);
+  assert (loaded.val (1) > 0);
+  check_model (loaded, clauses);
+
+  loaded.assume (-1);
+  loaded.assume (n + 1);
+  res = loaded.solve ();
+  assert (res == 20);
+  assert (loaded.failed (-1) || loaded.failed (n + 1));
+
+  // The loaded solver stays incremental.
+
+  loaded.add (-n);
+  loaded.add (0);
+  res = loaded.solve ();
+  assert (res == 10);
+  assert (loaded.val (1) < 0);
+
+  // Invalid snapshots are rejected.
+
+  const string dimacs = path ("cnf");
+  err = original.write_dimacs (dimacs.c_str ());
+  assert (!err);
+  Solver invalid;
+  err = invalid.load_snapshot (dimacs.c_str ());
+  assert (err);
+  cout << err << endl;
+
+  Solver missing;
+  err = missing.load_snapshot (path ("missing").c_str ());
+  assert (err);
+  cout << err << endl;
+
+  remove (image.c_str ());
+  remove (dimacs.c_str ());
+
+  return 0;
+}